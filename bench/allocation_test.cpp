@@ -0,0 +1,93 @@
+#include "keybind_table.h"
+#include "string_conversions.h"
+#include "test_support.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// Counts heap allocations through a replaced global operator new, so enum conversions are held
+// to zero allocations and MacroToJson to no more than a plain copy of the document it builds.
+
+static std::atomic<uint64_t> Allocations{0};
+
+void *operator new(const std::size_t Size) {
+    Allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void *Memory = std::malloc(Size ? Size : 1))
+        return Memory;
+    throw std::bad_alloc();
+}
+
+void *operator new[](const std::size_t Size) { return operator new(Size); }
+
+void operator delete(void *Memory) noexcept { std::free(Memory); }
+
+void operator delete[](void *Memory) noexcept { std::free(Memory); }
+
+void operator delete(void *Memory, std::size_t) noexcept { std::free(Memory); }
+
+void operator delete[](void *Memory, std::size_t) noexcept { std::free(Memory); }
+
+template <typename Operation> static uint64_t CountAllocations(Operation Op) {
+    const uint64_t Before = Allocations.load(std::memory_order_relaxed);
+    Op();
+    return Allocations.load(std::memory_order_relaxed) - Before;
+}
+
+static void TestEnumConversions() {
+    constexpr EMouseButton MouseButtons[] = {EMouseButton::Left, EMouseButton::Right, EMouseButton::Middle, EMouseButton::X1, EMouseButton::X2};
+    constexpr EWaitCondition WaitConditions[] = {EWaitCondition::OutOfCombat, EWaitCondition::InCombat, EWaitCondition::Mounted, EWaitCondition::Unmounted, EWaitCondition::MapChanged};
+    constexpr EMousePositionType PositionTypes[] = {EMousePositionType::Absolute, EMousePositionType::Relative};
+
+    bool RoundTrips = true;
+    const uint64_t Count = CountAllocations([&] {
+        for (const KeybindInfo &Keybind : KeybindTable) {
+            RoundTrips &= StringToIngameKeybind(IngameKeybindToString(Keybind.Bind)) == Keybind.Bind;
+            RoundTrips &= GetKeybindName(Keybind.Bind) != nullptr;
+        }
+        for (const EMouseButton Button : MouseButtons) {
+            RoundTrips &= StringToMouseButton(MouseButtonToString(Button)) == Button;
+            RoundTrips &= GetMouseButtonName(Button) != nullptr;
+        }
+        for (const EWaitCondition Condition : WaitConditions) {
+            RoundTrips &= StringToWaitCondition(WaitConditionToString(Condition)) == Condition;
+            RoundTrips &= GetWaitConditionName(Condition) != nullptr;
+        }
+        for (const EMousePositionType PositionType : PositionTypes)
+            RoundTrips &= StringToMousePositionType(MousePositionTypeToString(PositionType)) == PositionType;
+    });
+
+    CHECK(RoundTrips);
+    CHECK(Count == 0);
+}
+
+static void TestMacroToJson() {
+    ActionSequence Actions;
+    for (size_t i = 0; i < 1000; ++i) {
+        if (i % 4 == 3)
+            Actions.emplace_back(EMouseButton::Right, i % 2 == 0, EMousePosition(static_cast<int>(i), 5, EMousePositionType::Relative), 10);
+        else
+            Actions.emplace_back(KeybindTable[i % KeybindCount].Bind, i % 2 == 0, 10);
+    }
+
+    Macro Source("Allocation Test", "MACRO_ALLOCATION");
+    SetMacroActions(Source, std::move(Actions));
+
+    nlohmann::json Json;
+    const uint64_t SerializeCount = CountAllocations([&] { Json = MacroToJson(Source); });
+    const uint64_t CopyCount = CountAllocations([&] {
+        const nlohmann::json Copy = Json;
+        static_cast<void>(Copy);
+    });
+
+    CHECK(CopyCount > 0);
+    CHECK(SerializeCount <= CopyCount);
+    if (SerializeCount > CopyCount)
+        std::fprintf(stderr, "MacroToJson made %llu allocations, copying its result makes %llu\n", static_cast<unsigned long long>(SerializeCount), static_cast<unsigned long long>(CopyCount));
+}
+
+int main() {
+    InstallSimulatedApi("allocation_test");
+    TestEnumConversions();
+    TestMacroToJson();
+    return FinishTests();
+}
\ No newline at end of file
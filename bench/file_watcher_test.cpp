@@ -0,0 +1,145 @@
+#include "file_watcher.h"
+#include "macro_hot_reload.h"
+#include "macro_save.h"
+#include "test_support.h"
+#include <algorithm>
+#include <fstream>
+#include <thread>
+
+// Checks the native directory watcher, then edits, deletes and adds macro files behind the
+// addon's back and waits for hot reload to apply them, while its own saves stay ignored.
+
+template <typename Predicate> static bool WaitFor(Predicate Done) {
+    const auto Deadline = std::chrono::steady_clock::now() + std::chrono::seconds(3);
+    while (std::chrono::steady_clock::now() < Deadline) {
+        if (Done())
+            return true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    return Done();
+}
+
+static std::string ReadFile(const std::filesystem::path &Path) {
+    std::ifstream File(Path, std::ios::binary);
+    return std::string((std::istreambuf_iterator<char>(File)), std::istreambuf_iterator<char>());
+}
+
+static void WriteFile(const std::filesystem::path &Path, const std::string &Content) {
+    std::ofstream File(Path, std::ios::binary | std::ios::trunc);
+    File << Content;
+}
+
+static void TestDirectoryWatcher() {
+    const std::filesystem::path Directory = TestDirectory / "watched";
+    std::filesystem::create_directories(Directory);
+
+    const std::unique_ptr<FileWatcher> Watcher = CreateFileWatcher(Directory.string());
+    CHECK(Watcher != nullptr);
+    if (!Watcher)
+        return;
+    CHECK(!Watcher->HasChanges());
+
+    WriteFile(Directory / "first.json", "{}");
+    WriteFile(Directory / "second.json", "{}");
+    std::filesystem::rename(Directory / "second.json", Directory / "third.json");
+
+    std::vector<std::string> Seen;
+    CHECK(WaitFor([&] {
+        for (auto &Change : Watcher->TakeChanges())
+            Seen.push_back(std::move(Change));
+        return std::count(Seen.begin(), Seen.end(), "first.json") && std::count(Seen.begin(), Seen.end(), "second.json") && std::count(Seen.begin(), Seen.end(), "third.json");
+    }));
+    CHECK(!Watcher->HasChanges());
+
+    std::filesystem::remove(Directory / "first.json");
+    CHECK(WaitFor([&] {
+        const std::vector<std::string> Changes = Watcher->TakeChanges();
+        return std::count(Changes.begin(), Changes.end(), "first.json") > 0;
+    }));
+}
+
+static void TestHotReload() {
+    for (int i = 1; i <= 3; ++i) {
+        Macro NewMacro("Macro " + std::to_string(i), "MACRO_" + std::to_string(i));
+        SetMacroActions(NewMacro, {KeybindAction(GB_SkillWeapon1, true), KeybindAction(GB_SkillWeapon1, false, i * 10)});
+        Macros.Insert(std::move(NewMacro));
+    }
+
+    StartMacroHotReload();
+    CHECK(SaveMacrosToJson());
+
+    const uint64_t SavedVersion = Macros.Version();
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ApplyMacroFileChanges();
+    CHECK(Macros.Version() == SavedVersion);
+
+    const std::filesystem::path MacroDirectory = TestDirectory / "MacroManager" / "macros";
+    nlohmann::json Header = nlohmann::json::parse(ReadFile(MacroDirectory / "MACRO_1.json"));
+    Header["name"] = "Renamed Outside";
+    WriteFile(MacroDirectory / "MACRO_1.json", Header.dump());
+    CHECK(WaitFor([] {
+        ApplyMacroFileChanges();
+        const Macro *Renamed = Macros.Get(Macros.Find("MACRO_1"));
+        return Renamed && Renamed->Name == "Renamed Outside";
+    }));
+    CHECK(GetMacroActions(*Macros.Get(Macros.Find("MACRO_1")))->size() == 2);
+
+    std::filesystem::remove(MacroDirectory / "MACRO_2.json");
+    CHECK(WaitFor([] {
+        ApplyMacroFileChanges();
+        return Macros.Find("MACRO_2") == InvalidMacroHandle;
+    }));
+
+    Header["name"] = "Added Outside";
+    Header["identifier"] = "MACRO_7";
+    Header["enabled"] = true;
+    WriteFile(MacroDirectory / "MACRO_7.json", Header.dump());
+    CHECK(WaitFor([] {
+        ApplyMacroFileChanges();
+        return Macros.Find("MACRO_7") != InvalidMacroHandle;
+    }));
+    if (const Macro *Added = Macros.Get(Macros.Find("MACRO_7"))) {
+        CHECK(Added->Name == "Added Outside");
+        CHECK(!Added->Enabled);
+        CHECK(GetMacroActions(*Added)->size() == 2);
+    }
+
+    WriteFile(MacroDirectory / "MACRO_3.json", "{\"name\":");
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ApplyMacroFileChanges();
+    CHECK(Macros.Get(Macros.Find("MACRO_3")) && Macros.Get(Macros.Find("MACRO_3"))->Name == "Macro 3");
+
+    const std::filesystem::path SequencePath = TestDirectory / "MacroManager" / "sequences" / (Header["sequence"].get<std::string>() + ".json");
+    const std::filesystem::path HeldSequencePath = TestDirectory / "held-sequence.json";
+    std::filesystem::rename(SequencePath, HeldSequencePath);
+    Header["name"] = "Sequence Arrives Later";
+    Header["identifier"] = "MACRO_8";
+    WriteFile(MacroDirectory / "MACRO_8.json", Header.dump());
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ApplyMacroFileChanges();
+    CHECK(Macros.Find("MACRO_8") == InvalidMacroHandle);
+
+    std::filesystem::rename(HeldSequencePath, SequencePath);
+    CHECK(WaitFor([] {
+        ApplyMacroFileChanges();
+        return Macros.Find("MACRO_8") != InvalidMacroHandle;
+    }));
+    if (const Macro *Late = Macros.Get(Macros.Find("MACRO_8")))
+        CHECK(GetMacroActions(*Late)->size() == 2);
+
+    const uint64_t EditedVersion = Macros.Version();
+    CHECK(SaveMacrosToJson());
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ApplyMacroFileChanges();
+    CHECK(Macros.Version() == EditedVersion);
+
+    StopMacroHotReload();
+    Macros.Clear();
+}
+
+int main() {
+    InstallSimulatedApi("file_watcher_test");
+    TestDirectoryWatcher();
+    TestHotReload();
+    return FinishTests();
+}
\ No newline at end of file
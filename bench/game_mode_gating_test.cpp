@@ -0,0 +1,85 @@
+#include "game_state.h"
+#include "macro_executor.h"
+#include "test_support.h"
+#include <algorithm>
+#include <thread>
+
+// Runs a macro on a worker thread against a fake Mumble link and flips the map to a competitive
+// mode partway through, as the game would on a PvP or WvW transfer.
+
+static Mumble::Data FakeLink{};
+
+static void PublishLink(const bool IsCompetitive) {
+    FakeLink.Context.IsCompetitive = IsCompetitive;
+    ++FakeLink.UITick;
+    UpdateGameState();
+}
+
+static Macro MakeHoldingMacro() {
+    ActionSequence Actions;
+    for (int i = 0; i < 20; ++i) {
+        Actions.emplace_back(GB_SkillWeapon1, true, 25);
+        Actions.emplace_back(GB_SkillWeapon2, true, 0);
+        Actions.emplace_back(GB_SkillWeapon2, false, 25);
+    }
+
+    Macro Result("Gating Test", "MACRO_GATING");
+    SetMacroActions(Result, std::move(Actions));
+    return Result;
+}
+
+static bool IsHeldAtEnd(const EGameBinds Bind) {
+    const auto Last = std::find_if(SimulatedInputs.rbegin(), SimulatedInputs.rend(), [Bind](const SimulatedInput &Input) { return Input.Bind == Bind; });
+    return Last != SimulatedInputs.rend() && Last->IsPress;
+}
+
+static void TestAbortOnCompetitiveChange() {
+    PublishLink(false);
+    SimulatedInputs.clear();
+    SimulatedAlerts.clear();
+
+    const Macro Macro = MakeHoldingMacro();
+    std::thread Executor([&Macro] { ExecuteMacro(Macro); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(150));
+    PublishLink(true);
+    Executor.join();
+
+    const size_t Presses = std::count_if(SimulatedInputs.begin(), SimulatedInputs.end(), [](const SimulatedInput &Input) { return Input.IsPress; });
+    CHECK(Presses > 0);
+    CHECK(Presses < 40);
+    CHECK(!IsHeldAtEnd(GB_SkillWeapon1));
+    CHECK(!IsHeldAtEnd(GB_SkillWeapon2));
+    CHECK(std::any_of(SimulatedAlerts.begin(), SimulatedAlerts.end(), [](const std::string &Alert) { return Alert.find("PVP/WvW mode entered") != std::string::npos; }));
+}
+
+static void TestRefuseInCompetitiveMode() {
+    PublishLink(true);
+    SimulatedInputs.clear();
+    SimulatedAlerts.clear();
+
+    ExecuteMacro(MakeHoldingMacro());
+
+    CHECK(SimulatedInputs.empty());
+    CHECK(SimulatedAlerts.size() == 1);
+}
+
+static void TestCompleteInPve() {
+    PublishLink(false);
+    SimulatedInputs.clear();
+
+    Macro Quick("Gating Quick", "MACRO_GATING_QUICK");
+    SetMacroActions(Quick, {KeybindAction(GB_SkillWeapon3, true), KeybindAction(GB_SkillWeapon3, false, 5)});
+    ExecuteMacro(Quick);
+
+    CHECK(SimulatedInputs.size() == 2);
+    CHECK(!IsHeldAtEnd(GB_SkillWeapon3));
+}
+
+int main() {
+    InstallSimulatedApi("game_mode_gating_test");
+    MumbleLink = &FakeLink;
+    TestCompleteInPve();
+    TestAbortOnCompetitiveChange();
+    TestRefuseInCompetitiveMode();
+    return FinishTests();
+}
\ No newline at end of file
@@ -0,0 +1,161 @@
+#include "game_state.h"
+#include "test_support.h"
+#include <cwchar>
+#include <thread>
+
+// Scripts changes into a fake Mumble link and checks the published snapshot, the change events
+// and the profile switch that follows them, then reads the snapshot while the watcher updates it.
+
+static Mumble::Data FakeLink{};
+static std::vector<EGameStateEvent> ReceivedEvents;
+static std::vector<GameState> ReceivedStates;
+
+static void RecordEvent(const EGameStateEvent Event, const GameState &State) {
+    ReceivedEvents.push_back(Event);
+    ReceivedStates.push_back(State);
+}
+
+static void SetIdentity(const wchar_t *Name) {
+    std::swprintf(FakeLink.Identity, sizeof(FakeLink.Identity) / sizeof(wchar_t), L"{\"name\":\"%ls\",\"profession\":4,\"map_id\":%u,\"fov\":0.873}", Name, FakeLink.Context.MapID);
+}
+
+static void Tick() {
+    ++FakeLink.UITick;
+    UpdateGameState();
+}
+
+static void TestSnapshotAndEvents() {
+    FakeLink.Context.MapID = 15;
+    FakeLink.Context.MapType = 5;
+    SetIdentity(L"Alice");
+    Tick();
+    CHECK(ReceivedEvents.empty());
+
+    const GameState Initial = GetGameState();
+    CHECK(Initial.UITick == FakeLink.UITick);
+    CHECK(Initial.MapID == 15);
+    CHECK(Initial.MapType == 5);
+    CHECK(Initial.CharacterHash != 0);
+    CHECK(!Initial.IsCompetitive);
+    CHECK(Initial.Mount == Mumble::EMountIndex::None);
+
+    FakeLink.Context.MapID = 1206;
+    UpdateGameState();
+    CHECK(ReceivedEvents.empty());
+    CHECK(GetGameState().MapID == 15);
+
+    const uint32_t MapChanges = GetGameStateEventCount(EGameStateEvent::MapChanged);
+    SetIdentity(L"Alice");
+    Tick();
+    CHECK(ReceivedEvents.size() == 1 && ReceivedEvents[0] == EGameStateEvent::MapChanged);
+    CHECK(ReceivedStates.back().MapID == 1206);
+    CHECK(GetGameStateEventCount(EGameStateEvent::MapChanged) == MapChanges + 1);
+    CHECK(GetGameState().CharacterHash == Initial.CharacterHash);
+
+    FakeLink.Context.MountIndex = Mumble::EMountIndex::Skyscale;
+    FakeLink.Context.IsCompetitive = 1;
+    SetIdentity(L"Bob");
+    Tick();
+    CHECK(ReceivedEvents.size() == 4);
+    CHECK(ReceivedEvents.size() == 4 && ReceivedEvents[1] == EGameStateEvent::CompetitiveChanged && ReceivedEvents[2] == EGameStateEvent::CharacterChanged && ReceivedEvents[3] == EGameStateEvent::MountChanged);
+
+    const GameState Changed = GetGameState();
+    CHECK(Changed.IsCompetitive);
+    CHECK(Changed.Mount == Mumble::EMountIndex::Skyscale);
+    CHECK(Changed.CharacterHash != Initial.CharacterHash);
+
+    Tick();
+    CHECK(ReceivedEvents.size() == 4);
+}
+
+static void TestProfileSwitch() {
+    FakeLink.Context.IsCompetitive = 0;
+    FakeLink.Context.MapID = 50;
+    SetIdentity(L"Alice");
+    Tick();
+
+    MacroProfiles.emplace_back("Alice Only", "Alice", 0);
+    MacroProfiles.emplace_back("Alice Map 50", "Alice", 50);
+
+    Macro Shared("Shared", "MACRO_1");
+    Macro AliceMacro("Alice", "MACRO_2");
+    AliceMacro.Profile = "Alice Map 50";
+    Macros.Insert(std::move(Shared));
+    Macros.Insert(std::move(AliceMacro));
+    CompileMacroProfiles();
+
+    UpdateActiveMacroProfile();
+    CHECK(GetCurrentCharacterName() == "Alice");
+    CHECK(GetActiveMacroProfile() && GetActiveMacroProfile()->Name == "Alice Map 50");
+    CHECK(FindActiveMacro("MACRO_1") != nullptr);
+    CHECK(FindActiveMacro("MACRO_2") != nullptr);
+
+    FakeLink.Context.MapID = 51;
+    SetIdentity(L"Alice");
+    Tick();
+    UpdateActiveMacroProfile();
+    CHECK(GetActiveMacroProfile() && GetActiveMacroProfile()->Name == "Alice Only");
+    CHECK(FindActiveMacro("MACRO_1") != nullptr);
+    CHECK(FindActiveMacro("MACRO_2") == nullptr);
+
+    for (size_t i = 0; i < sizeof(FakeLink.Identity) / sizeof(wchar_t); ++i)
+        FakeLink.Identity[i] = L' ';
+    std::wmemcpy(FakeLink.Identity, L"{\"name\":\"Bob\"}", 14);
+    Tick();
+    UpdateActiveMacroProfile();
+    CHECK(GetCurrentCharacterName() == "Bob");
+    CHECK(GetActiveMacroProfile() && GetActiveMacroProfile()->Name == "Default");
+
+    DeleteMacroProfile(1);
+    CHECK(Macros.Get(Macros.Find("MACRO_2")) && Macros.Get(Macros.Find("MACRO_2"))->Profile.empty());
+    CHECK(FindActiveMacro("MACRO_2") != nullptr);
+
+    MacroProfiles.clear();
+    Macros.Clear();
+    CompileMacroProfiles();
+}
+
+static void TestWatcherSnapshotConsistency() {
+    UnsubscribeGameState(RecordEvent);
+    FakeLink.Context.MapID = 999;
+    FakeLink.Context.MapType = 999 * 2 + 1;
+    Tick();
+    StartGameStateWatcher();
+
+    std::atomic<bool> Stop{false};
+    std::atomic<uint32_t> Torn{0};
+    std::thread Reader([&] {
+        while (!Stop.load(std::memory_order_relaxed)) {
+            const GameState State = GetGameState();
+            if (State.MapType != State.MapID * 2 + 1)
+                Torn.fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+
+    uint32_t LastTick = GetGameState().UITick;
+    for (uint32_t i = 0; i < 40; ++i) {
+        FakeLink.Context.MapID = 1000 + i;
+        FakeLink.Context.MapType = (1000 + i) * 2 + 1;
+        std::atomic_thread_fence(std::memory_order_release);
+        ++FakeLink.UITick;
+        LastTick = WaitForGameStateTick(LastTick, std::chrono::milliseconds(500));
+        CHECK(LastTick == FakeLink.UITick);
+    }
+
+    Stop.store(true);
+    Reader.join();
+    StopGameStateWatcher();
+
+    CHECK(Torn.load() == 0);
+    CHECK(GetGameState().MapID == 1039);
+}
+
+int main() {
+    InstallSimulatedApi("game_state_test");
+    MumbleLink = &FakeLink;
+    CHECK(SubscribeGameState(RecordEvent));
+    TestSnapshotAndEvents();
+    TestProfileSwitch();
+    TestWatcherSnapshotConsistency();
+    return FinishTests();
+}
\ No newline at end of file
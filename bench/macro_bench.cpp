@@ -0,0 +1,474 @@
+#include "action_history.h"
+#include "action_sequence_store.h"
+#include "keybind_manager.h"
+#include "keybind_search.h"
+#include "keybind_table.h"
+#include "macro.h"
+#include "macro_executor.h"
+#include "macro_manager.h"
+#include "macro_profile.h"
+#include "macro_profiler.h"
+#include "macro_save.h"
+#include "macro_sax.h"
+#include "macro_share_code.h"
+#include "macro_timeline.h"
+#include "shared.h"
+#include "string_conversions.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <malloc.h>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Prints one JSON object per benchmark so runs from different commits can be diffed or loaded directly.
+// Usage: macro_bench [--quick] [--filter <substring>]
+
+static uint64_t SimulatedPresses = 0;
+static uint64_t SimulatedReleases = 0;
+
+static void SimulatedLog(ELogLevel, const char *, const char *) {}
+static void SimulatedAlert(const char *) {}
+static void SimulatedPress(EGameBinds) { ++SimulatedPresses; }
+static void SimulatedRelease(EGameBinds) { ++SimulatedReleases; }
+static void SimulatedRegisterBind(const char *, INPUTBINDS_PROCESS, const char *) {}
+static void SimulatedDeregisterBind(const char *) {}
+
+static std::filesystem::path BenchDirectory;
+
+static const char *SimulatedAddonDirectory(const char *Name) {
+    thread_local std::string Path;
+    Path = (BenchDirectory / Name).string();
+    return Path.c_str();
+}
+
+static std::atomic<bool> HeapTracking{false};
+static std::atomic<int64_t> HeapLiveBytes{0};
+static std::atomic<int64_t> HeapPeakBytes{0};
+
+void *operator new(const std::size_t Size) {
+    void *Memory = std::malloc(Size ? Size : 1);
+    if (!Memory)
+        throw std::bad_alloc();
+    if (HeapTracking.load(std::memory_order_relaxed)) {
+        const int64_t Live = HeapLiveBytes.fetch_add(static_cast<int64_t>(malloc_usable_size(Memory)), std::memory_order_relaxed) + static_cast<int64_t>(malloc_usable_size(Memory));
+        int64_t Peak = HeapPeakBytes.load(std::memory_order_relaxed);
+        while (Live > Peak && !HeapPeakBytes.compare_exchange_weak(Peak, Live, std::memory_order_relaxed)) {
+        }
+    }
+    return Memory;
+}
+
+void *operator new[](const std::size_t Size) { return operator new(Size); }
+
+void operator delete(void *Memory) noexcept {
+    if (Memory && HeapTracking.load(std::memory_order_relaxed))
+        HeapLiveBytes.fetch_sub(static_cast<int64_t>(malloc_usable_size(Memory)), std::memory_order_relaxed);
+    std::free(Memory);
+}
+
+void operator delete[](void *Memory) noexcept { operator delete(Memory); }
+
+void operator delete(void *Memory, std::size_t) noexcept { operator delete(Memory); }
+
+void operator delete[](void *Memory, std::size_t) noexcept { operator delete(Memory); }
+
+static bool QuickRun = false;
+static const char *BenchmarkFilter = nullptr;
+
+template <typename T> static void DoNotOptimize(const T &Value) { asm volatile("" : : "r,m"(Value) : "memory"); }
+
+template <typename Operation> static double TimeIterations(const uint64_t Iterations, Operation &Op) {
+    const auto Start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0; i < Iterations; ++i)
+        Op();
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - Start).count();
+}
+
+template <typename Operation> static void RunBenchmark(const char *Name, const size_t ItemsPerOperation, Operation Op) {
+    if (BenchmarkFilter && !std::strstr(Name, BenchmarkFilter))
+        return;
+
+    const double SampleNanoseconds = QuickRun ? 2e6 : 2e7;
+    const int SampleCount = QuickRun ? 3 : 7;
+
+    uint64_t Iterations = 1;
+    while (TimeIterations(Iterations, Op) < SampleNanoseconds && Iterations < (1ull << 40))
+        Iterations *= 2;
+
+    std::vector<double> Samples;
+    for (int i = 0; i < SampleCount; ++i)
+        Samples.push_back(TimeIterations(Iterations, Op) / static_cast<double>(Iterations));
+    std::sort(Samples.begin(), Samples.end());
+
+    const double Median = Samples[Samples.size() / 2];
+    std::printf("{\"benchmark\":\"%s\",\"items\":%zu,\"iterations\":%llu,\"samples\":%d,\"ns_per_op\":%.2f,\"min_ns_per_op\":%.2f,\"ns_per_item\":%.3f}\n", Name, ItemsPerOperation, static_cast<unsigned long long>(Iterations), SampleCount, Median, Samples.front(), Median / static_cast<double>(ItemsPerOperation));
+    std::fflush(stdout);
+}
+
+template <typename Operation> static void MeasurePeakHeap(const char *Name, Operation Op) {
+    if (BenchmarkFilter && !std::strstr(Name, BenchmarkFilter))
+        return;
+
+    HeapLiveBytes.store(0);
+    HeapPeakBytes.store(0);
+    HeapTracking.store(true);
+    Op();
+    HeapTracking.store(false);
+    std::printf("{\"benchmark\":\"%s\",\"peak_heap_bytes\":%lld}\n", Name, static_cast<long long>(HeapPeakBytes.load()));
+    std::fflush(stdout);
+}
+
+static ActionSequence MakeBenchActions(const size_t Count) {
+    ActionSequence Actions;
+    Actions.reserve(Count);
+    for (size_t i = 0; i < Count; ++i) {
+        const EGameBinds Bind = KeybindTable[i % KeybindCount].Bind;
+        switch (i % 8) {
+        case 0:
+        case 2:
+            Actions.emplace_back(Bind, true, 0);
+            break;
+        case 1:
+        case 3:
+            Actions.emplace_back(Bind, false, 0);
+            break;
+        case 4:
+            Actions.emplace_back(EMouseButton::Left, true, 0);
+            break;
+        case 5:
+            Actions.emplace_back(EMouseButton::Left, false, 0);
+            break;
+        case 6:
+            Actions.emplace_back(EMousePosition(static_cast<int>(i), static_cast<int>(i), EMousePositionType::Relative), 0);
+            break;
+        default:
+            Actions.emplace_back(GB_SkillHeal, false, 0);
+            break;
+        }
+    }
+    return Actions;
+}
+
+static void BenchmarkJson() {
+    Macro Source("Bench Macro", "MACRO_BENCH_JSON");
+    SetMacroActions(Source, MakeBenchActions(64));
+    const nlohmann::json Json = MacroToJson(Source);
+    const std::string JsonText = Json.dump();
+
+    RunBenchmark("macro_to_json", 64, [&] { DoNotOptimize(MacroToJson(Source)); });
+    RunBenchmark("json_to_macro", 64, [&] { DoNotOptimize(JsonToMacro(Json)); });
+    RunBenchmark("json_dump", 64, [&] { DoNotOptimize(Json.dump()); });
+    RunBenchmark("parse_macro_json", 64, [&] { DoNotOptimize(ParseMacroJson(JsonText)); });
+}
+
+static void BenchmarkShareCode() {
+    Macro Source("Bench Share Code", "MACRO_BENCH_SHARE");
+    SetMacroActions(Source, MakeBenchActions(64));
+    const std::string Code = MacroToShareCode(Source);
+
+    RunBenchmark("share_code_encode", 64, [&] { DoNotOptimize(MacroToShareCode(Source)); });
+    RunBenchmark("share_code_decode", 64, [&] { DoNotOptimize(ShareCodeToMacro(Code)); });
+}
+
+static void BenchmarkStringConversions() {
+    std::vector<std::string> KeybindStrings;
+    for (const KeybindInfo &Keybind : KeybindTable)
+        KeybindStrings.emplace_back(IngameKeybindToString(Keybind.Bind));
+
+    const std::vector<std::string> MouseButtonStrings = {std::string(MouseButtonToString(EMouseButton::Left)), std::string(MouseButtonToString(EMouseButton::Right)), std::string(MouseButtonToString(EMouseButton::Middle)), std::string(MouseButtonToString(EMouseButton::X1)), std::string(MouseButtonToString(EMouseButton::X2))};
+    const std::vector<std::string> WaitConditionStrings = {std::string(WaitConditionToString(EWaitCondition::OutOfCombat)), std::string(WaitConditionToString(EWaitCondition::InCombat)), std::string(WaitConditionToString(EWaitCondition::Mounted)), std::string(WaitConditionToString(EWaitCondition::Unmounted)), std::string(WaitConditionToString(EWaitCondition::MapChanged))};
+
+    RunBenchmark("string_to_keybind", KeybindStrings.size(), [&] {
+        for (const std::string &String : KeybindStrings)
+            DoNotOptimize(StringToIngameKeybind(String));
+    });
+    RunBenchmark("keybind_to_string", KeybindCount, [&] {
+        for (const KeybindInfo &Keybind : KeybindTable)
+            DoNotOptimize(IngameKeybindToString(Keybind.Bind));
+    });
+    RunBenchmark("string_to_mouse_button", MouseButtonStrings.size(), [&] {
+        for (const std::string &String : MouseButtonStrings)
+            DoNotOptimize(StringToMouseButton(String));
+    });
+    RunBenchmark("string_to_wait_condition", WaitConditionStrings.size(), [&] {
+        for (const std::string &String : WaitConditionStrings)
+            DoNotOptimize(StringToWaitCondition(String));
+    });
+}
+
+static void BenchmarkKeybindSearch() {
+    const std::vector<std::string> PrefixQueries = {"sk", "skill", "weapon skill 1", "mount", "target", "camera"};
+    const std::vector<std::string> FuzzyQueries = {"wepon skil", "healng skill", "swap weapns", "screnshot", "free camra", "elite skil"};
+    const std::vector<std::string> MissQueries = {"zq", "xylophone", "qqqzzz", "jukebox vortex", "wxyz", "plmokn"};
+
+    for (const auto &[Name, Queries] : {std::pair{"keybind_search_prefix", &PrefixQueries}, std::pair{"keybind_search_fuzzy", &FuzzyQueries}, std::pair{"keybind_search_miss", &MissQueries}}) {
+        RunBenchmark(Name, Queries->size(), [Queries] {
+            for (const std::string &Query : *Queries)
+                DoNotOptimize(SearchKeybinds(Query, 12));
+        });
+    }
+}
+
+static void BenchmarkDispatch() {
+    constexpr size_t MacroCount = 200;
+    for (size_t i = 0; i < MacroCount; ++i) {
+        Macro Macro("Bench " + std::to_string(i), "MACRO_BENCH_" + std::to_string(i));
+        SetMacroActions(Macro, {KeybindAction(GB_SkillWeapon1, true), KeybindAction(GB_SkillWeapon1, false)});
+        Macros.Insert(std::move(Macro));
+    }
+    CompileMacroProfiles();
+
+    const std::string Identifier = "MACRO_BENCH_" + std::to_string(MacroCount / 2);
+    RunBenchmark("process_keybind_dispatch", 1, [&] { ProcessKeybind(Identifier.c_str(), false); });
+    RunBenchmark("process_keybind_release", 1, [&] { ProcessKeybind(Identifier.c_str(), true); });
+    RunBenchmark("process_keybind_unbound", 1, [] { ProcessKeybind("MACRO_BENCH_UNBOUND", false); });
+}
+
+static void BenchmarkLibrary() {
+    constexpr size_t MacroCount = 10000;
+    MacroLibrary Library;
+    std::vector<MacroHandle> Handles;
+    std::vector<std::string> Identifiers;
+    for (size_t i = 0; i < MacroCount; ++i) {
+        Identifiers.push_back("MACRO_" + std::to_string(i + 1));
+        Handles.push_back(Library.Insert(Macro("Library " + std::to_string(i), Identifiers.back())));
+    }
+
+    size_t Next = 0;
+    RunBenchmark("library_get", 1, [&] { DoNotOptimize(Library.Get(Handles[Next++ % MacroCount])); });
+    RunBenchmark("library_find", 1, [&] { DoNotOptimize(Library.Find(Identifiers[Next++ % MacroCount])); });
+    RunBenchmark("library_insert_erase", 1, [&] {
+        const size_t Index = Next++ % MacroCount;
+        Library.Erase(Handles[Index]);
+        Handles[Index] = Library.Insert(Macro("Library", Identifiers[Index]));
+    });
+}
+
+static void BenchmarkLazyBodies() {
+    const ActionSequence Actions = MakeBenchActions(256);
+    const std::string BodyPath = (BenchDirectory / "lazy_body.json").string();
+    {
+        std::ofstream BodyFile(BodyPath, std::ios::binary);
+        BodyFile << ActionsToJson(Actions).dump();
+    }
+
+    Macro FromFile("Lazy File", "MACRO_BENCH_LAZY_FILE");
+    FromFile.Storage.BodyPath = BodyPath;
+    RunBenchmark("lazy_body_load_file", 256, [&] {
+        FromFile.Actions.reset();
+        DoNotOptimize(GetMacroActions(FromFile));
+    });
+
+    Macro Interned("Lazy Interned", "MACRO_BENCH_LAZY_INTERNED");
+    Interned.Storage.SequenceHash = HashActionSequence(*InternActionSequence(Actions));
+    RunBenchmark("lazy_body_load_interned", 256, [&] {
+        Interned.Actions.reset();
+        DoNotOptimize(GetMacroActions(Interned));
+    });
+}
+
+static void FillLibrary(const size_t Count, const size_t ActionsPerMacro) {
+    Macros.Clear();
+    for (size_t i = 0; i < Count; ++i) {
+        Macro NewMacro("Bench Library " + std::to_string(i), "MACRO_" + std::to_string(i + 1));
+        ActionSequence Actions = MakeBenchActions(ActionsPerMacro);
+        Actions.front().DelayMilliseconds = static_cast<int>(i);
+        SetMacroActions(NewMacro, std::move(Actions));
+        Macros.Insert(std::move(NewMacro));
+    }
+}
+
+static void BenchmarkPersistence() {
+    constexpr size_t MacroCount = 200;
+    FillLibrary(MacroCount, 16);
+    SaveMacrosToJson();
+
+    RunBenchmark("save_unchanged", MacroCount, [] { SaveMacrosToJson(); });
+
+    int Delay = 0;
+    RunBenchmark("save_one_changed", MacroCount, [&] {
+        ActionSequence Actions = *GetMacroActions(Macros[0]);
+        Actions.back().DelayMilliseconds = ++Delay % 1000;
+        SetMacroActions(Macros[0], std::move(Actions));
+        SaveMacrosToJson();
+    });
+
+    RunBenchmark("load_manifest", MacroCount, [] { DoNotOptimize(LoadMacrosFromJson()); });
+
+    std::vector<MacroHandle> Handles;
+    for (size_t i = 0; i < Macros.size(); ++i)
+        Handles.push_back(Macros.HandleAt(i));
+    std::ostringstream Exported;
+    ExportMacrosToNdjson(Exported, Handles);
+    const std::string Ndjson = Exported.str();
+
+    RunBenchmark("ndjson_export", MacroCount, [&] {
+        std::ostringstream Stream;
+        DoNotOptimize(ExportMacrosToNdjson(Stream, Handles));
+    });
+    RunBenchmark("ndjson_parse", MacroCount, [&] {
+        std::istringstream Stream(Ndjson);
+        std::string Line;
+        while (std::getline(Stream, Line))
+            DoNotOptimize(ParseMacroJson(Line));
+    });
+
+    nlohmann::json Library;
+    for (const auto &Macro : Macros)
+        Library["macros"].push_back(MacroToJson(Macro));
+    const std::string LibraryText = Library.dump();
+    RunBenchmark("parse_library_sax", MacroCount, [&] {
+        std::istringstream Stream(LibraryText);
+        DoNotOptimize(ParseMacroLibraryJson(Stream));
+    });
+
+    Macros.Clear();
+}
+
+static void BenchmarkLibraryParsing() {
+    constexpr size_t MacroCount = 1000;
+    FillLibrary(MacroCount, 64);
+    const std::string ExportPath = (BenchDirectory / "library_export.json").string();
+    {
+        nlohmann::json Library;
+        for (const auto &Macro : Macros)
+            Library["macros"].push_back(MacroToJson(Macro));
+        std::ofstream ExportFile(ExportPath, std::ios::binary);
+        ExportFile << Library.dump();
+    }
+    Macros.Clear();
+
+    const auto ParseSax = [&] {
+        std::ifstream Stream(ExportPath, std::ios::binary);
+        DoNotOptimize(ParseMacroLibraryJson(Stream));
+    };
+    const auto ParseDom = [&] {
+        std::ifstream Stream(ExportPath, std::ios::binary);
+        const nlohmann::json Library = nlohmann::json::parse(Stream);
+        std::vector<Macro> Result;
+        for (const auto &MacroJson : Library.at("macros"))
+            Result.push_back(JsonToMacro(MacroJson));
+        DoNotOptimize(Result);
+    };
+
+    RunBenchmark("parse_export_sax", MacroCount, ParseSax);
+    RunBenchmark("parse_export_dom", MacroCount, ParseDom);
+    MeasurePeakHeap("parse_export_sax_memory", ParseSax);
+    MeasurePeakHeap("parse_export_dom_memory", ParseDom);
+}
+
+static void BenchmarkEditorSequence() {
+    constexpr size_t ActionCount = 100000;
+    const PersistentActionSequence Sequence(MakeBenchActions(ActionCount));
+    const KeybindAction Replacement(GB_SkillWeapon5, true, 7);
+
+    size_t Next = 0;
+    RunBenchmark("rope_set", 1, [&] { DoNotOptimize(Sequence.Set(Next++ % ActionCount, Replacement)); });
+    RunBenchmark("rope_insert", 1, [&] { DoNotOptimize(Sequence.Insert(Next++ % ActionCount, Replacement)); });
+    RunBenchmark("rope_erase", 1, [&] { DoNotOptimize(Sequence.Erase(Next++ % ActionCount)); });
+    RunBenchmark("rope_to_vector", ActionCount, [&] { DoNotOptimize(Sequence.ToVector()); });
+
+    std::vector<bool> Selection(ActionCount);
+    for (size_t i = 0; i < ActionCount; i += 2)
+        Selection[i] = true;
+    RunBenchmark("rope_erase_selected", ActionCount, [&] {
+        std::vector<bool> Erased = Selection;
+        DoNotOptimize(Sequence.EraseSelected(Erased));
+    });
+    RunBenchmark("rope_move_selected", ActionCount, [&] {
+        std::vector<bool> Moved = Selection;
+        DoNotOptimize(Sequence.MoveSelected(Moved, 1));
+    });
+    RunBenchmark("rope_move_selected_to_edge", ActionCount, [&] {
+        std::vector<bool> Moved = Selection;
+        DoNotOptimize(Sequence.MoveSelectedToEdge(Moved, true));
+    });
+    RunBenchmark("rope_duplicate_selected", ActionCount, [&] {
+        std::vector<bool> Duplicated = Selection;
+        DoNotOptimize(Sequence.DuplicateSelected(Duplicated));
+    });
+    RunBenchmark("rope_scale_selected", ActionCount, [&] { DoNotOptimize(Sequence.ScaleSelectedDelays(Selection, 150)); });
+}
+
+static void BenchmarkTimeline() {
+    constexpr uint32_t EventsPerDrain = 256;
+    const KeybindAction Action(GB_SkillWeapon1, true);
+    SetMacroTimelineRecording(true);
+    RunBenchmark("timeline_record_drain", EventsPerDrain, [&] {
+        const uint32_t Run = BeginMacroTimelineRun();
+        const auto Scheduled = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < EventsPerDrain; ++i)
+            RecordMacroTimelineAction(Run, i, Action, Scheduled);
+        DrainMacroTimeline();
+    });
+    SetMacroTimelineRecording(false);
+}
+
+static void BenchmarkProfiler() {
+    RunBenchmark("profile_rdtsc_pair", 1, [] { DoNotOptimize(__rdtsc() - __rdtsc()); });
+    RunBenchmark("profile_scope", 1, [] { MACRO_PROFILE_SCOPE(EProfileScope::ProcessKeybind); });
+    RunBenchmark("profile_update", 1, [] { UpdateProfileStats(); });
+}
+
+static void BenchmarkExecutor() {
+    Macro Macro("Bench Executor", "MACRO_BENCH_EXECUTOR");
+    SetMacroActions(Macro, MakeBenchActions(1000));
+    RunBenchmark("execute_macro", 1000, [&] { ExecuteMacro(Macro); });
+}
+
+int main(int argc, char **argv) {
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--quick") == 0)
+            QuickRun = true;
+        else if (std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc)
+            BenchmarkFilter = argv[++i];
+        else {
+            std::fprintf(stderr, "Usage: %s [--quick] [--filter <substring>]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    static AddonAPI_t SimulatedApi{};
+    SimulatedApi.Log = SimulatedLog;
+    SimulatedApi.GUI_SendAlert = SimulatedAlert;
+    SimulatedApi.GameBinds_PressAsync = SimulatedPress;
+    SimulatedApi.GameBinds_ReleaseAsync = SimulatedRelease;
+    SimulatedApi.InputBinds_RegisterWithString = SimulatedRegisterBind;
+    SimulatedApi.InputBinds_Deregister = SimulatedDeregisterBind;
+    SimulatedApi.Paths_GetAddonDirectory = SimulatedAddonDirectory;
+    ApiDefinition = &SimulatedApi;
+
+    BenchDirectory = std::filesystem::temp_directory_path() / ("macro_bench-" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()));
+    std::filesystem::create_directories(BenchDirectory / "MacroManager");
+
+    BenchmarkJson();
+    BenchmarkShareCode();
+    BenchmarkStringConversions();
+    BenchmarkKeybindSearch();
+    BenchmarkLibrary();
+    BenchmarkLazyBodies();
+    BenchmarkPersistence();
+    BenchmarkLibraryParsing();
+    BenchmarkEditorSequence();
+    BenchmarkTimeline();
+    BenchmarkProfiler();
+    BenchmarkDispatch();
+    BenchmarkExecutor();
+
+    std::error_code Error;
+    std::filesystem::remove_all(BenchDirectory, Error);
+
+    if (!BenchmarkFilter && (SimulatedPresses == 0 || SimulatedReleases == 0)) {
+        std::fprintf(stderr, "Executor emitted no simulated inputs\n");
+        return 1;
+    }
+    return 0;
+}
\ No newline at end of file
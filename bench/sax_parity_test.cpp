@@ -0,0 +1,116 @@
+#include "macro_sax.h"
+#include "test_support.h"
+#include <functional>
+
+// Feeds the same well-formed and malformed macro documents to the streaming parser and to
+// JsonToMacro, which must agree on whether each one is accepted and on what it decodes to.
+
+struct ParseOutcome {
+    bool Accepted = false;
+    std::string Summary;
+};
+
+static std::string Summarize(const Macro &Parsed) {
+    std::string Summary = Parsed.Name + "|" + Parsed.Identifier + "|" + Parsed.Profile + "|" + (Parsed.Enabled ? "1" : "0");
+    for (const KeybindAction &Action : *GetMacroActions(Parsed)) {
+        Summary += "|" + std::to_string(static_cast<int>(Action.MacroInputType)) + "," + std::to_string(Action.DelayMilliseconds) + "," + std::to_string(Action.IsKeybindDown) + "," + std::to_string(Action.MoveBeforeMouseClick);
+        Summary += "," + std::to_string(Action.MousePosition.x) + "," + std::to_string(Action.MousePosition.y) + "," + std::to_string(Action.TimeoutMilliseconds);
+    }
+    return Summary;
+}
+
+static ParseOutcome ParseWithSax(const std::string &Document) {
+    try {
+        return {true, Summarize(ParseMacroJson(Document))};
+    } catch (const std::exception &) {
+        return {};
+    }
+}
+
+static ParseOutcome ParseWithDom(const std::string &Document) {
+    try {
+        return {true, Summarize(JsonToMacro(nlohmann::json::parse(Document)))};
+    } catch (const std::exception &) {
+        return {};
+    }
+}
+
+static nlohmann::json MakeBaseDocument() {
+    Macro Base("Parity", "MACRO_PARITY");
+    Base.Profile = "Raid";
+    Base.Enabled = true;
+    SetMacroActions(Base, {KeybindAction(GB_SkillWeapon1, true, 10), KeybindAction(EMouseButton::Right, false, EMousePosition(40, -12, EMousePositionType::Relative), 5), KeybindAction(EMousePosition(300, 200, EMousePositionType::Absolute), 0), KeybindAction(EWaitCondition::OutOfCombat, 2500, 15)});
+    return MacroToJson(Base);
+}
+
+static void CheckParity(const char *Case, const std::string &Document, const bool ExpectAccepted) {
+    const ParseOutcome Sax = ParseWithSax(Document);
+    const ParseOutcome Dom = ParseWithDom(Document);
+    CHECK(Sax.Accepted == Dom.Accepted);
+    CHECK(Sax.Summary == Dom.Summary);
+    CHECK(Dom.Accepted == ExpectAccepted);
+    if (Sax.Accepted != Dom.Accepted || Sax.Summary != Dom.Summary || Dom.Accepted != ExpectAccepted)
+        std::fprintf(stderr, "case '%s': sax %s, dom %s\n", Case, Sax.Accepted ? "accepted" : "rejected", Dom.Accepted ? "accepted" : "rejected");
+}
+
+static void TestMutatedDocuments() {
+    struct Mutation {
+        const char *Case;
+        bool Accepted;
+        std::function<void(nlohmann::json &)> Apply;
+    };
+
+    const Mutation Mutations[] = {
+        {"unchanged", true, [](nlohmann::json &) {}},
+        {"float delay", true, [](nlohmann::json &Json) { Json["actions"][0]["delayMs"] = 12.75; }},
+        {"missing delay", true, [](nlohmann::json &Json) { Json["actions"][0].erase("delayMs"); }},
+        {"unknown keys", true, [](nlohmann::json &Json) { Json["extra"] = {1, 2}; Json["actions"][1]["note"] = {{"a", true}}; }},
+        {"positioned click without move", true, [](nlohmann::json &Json) { Json["actions"][1]["moveBeforeClick"] = false; Json["actions"][1]["mouseX"] = true; }},
+        {"empty actions", true, [](nlohmann::json &Json) { Json["actions"] = nlohmann::json::array(); }},
+        {"boolean delay", false, [](nlohmann::json &Json) { Json["actions"][0]["delayMs"] = true; }},
+        {"false delay", false, [](nlohmann::json &Json) { Json["actions"][0]["delayMs"] = false; }},
+        {"string delay", false, [](nlohmann::json &Json) { Json["actions"][0]["delayMs"] = "10"; }},
+        {"null delay", false, [](nlohmann::json &Json) { Json["actions"][0]["delayMs"] = nullptr; }},
+        {"array delay", false, [](nlohmann::json &Json) { Json["actions"][0]["delayMs"] = {1}; }},
+        {"boolean timeout", false, [](nlohmann::json &Json) { Json["actions"][3]["timeoutMs"] = true; }},
+        {"boolean move x", false, [](nlohmann::json &Json) { Json["actions"][2]["mouseX"] = true; }},
+        {"boolean click y", false, [](nlohmann::json &Json) { Json["actions"][1]["mouseY"] = false; }},
+        {"numeric key state", false, [](nlohmann::json &Json) { Json["actions"][0]["isKeyDown"] = 1; }},
+        {"numeric enabled", false, [](nlohmann::json &Json) { Json["enabled"] = 1; }},
+        {"numeric name", false, [](nlohmann::json &Json) { Json["name"] = 5; }},
+        {"empty name", false, [](nlohmann::json &Json) { Json["name"] = ""; }},
+        {"missing name", false, [](nlohmann::json &Json) { Json.erase("name"); }},
+        {"missing actions", false, [](nlohmann::json &Json) { Json.erase("actions"); }},
+        {"object actions", false, [](nlohmann::json &Json) { Json["actions"] = nlohmann::json::object(); }},
+        {"scalar action", false, [](nlohmann::json &Json) { Json["actions"].push_back(5); }},
+        {"missing input type", false, [](nlohmann::json &Json) { Json["actions"][0].erase("inputType"); }},
+        {"numeric input type", false, [](nlohmann::json &Json) { Json["actions"][0]["inputType"] = 3; }},
+        {"unknown input type", false, [](nlohmann::json &Json) { Json["actions"][0]["inputType"] = "Teleport"; }},
+        {"missing game bind", false, [](nlohmann::json &Json) { Json["actions"][0].erase("gameBind"); }},
+        {"unknown game bind", true, [](nlohmann::json &Json) { Json["actions"][0]["gameBind"] = "GB_NotABind"; }},
+        {"missing move y", false, [](nlohmann::json &Json) { Json["actions"][2].erase("mouseY"); }},
+        {"unknown condition", true, [](nlohmann::json &Json) { Json["actions"][3]["condition"] = "Sleeping"; }},
+        {"invalid identifier", false, [](nlohmann::json &Json) { Json["identifier"] = "has space"; }},
+        {"numeric profile", false, [](nlohmann::json &Json) { Json["profile"] = 3; }},
+    };
+
+    for (const Mutation &Mutation : Mutations) {
+        nlohmann::json Document = MakeBaseDocument();
+        Mutation.Apply(Document);
+        CheckParity(Mutation.Case, Document.dump(), Mutation.Accepted);
+    }
+}
+
+static void TestMalformedText() {
+    CheckParity("top-level array", "[]", false);
+    CheckParity("top-level number", "42", false);
+    CheckParity("truncated", MakeBaseDocument().dump().substr(0, 40), false);
+    CheckParity("trailing garbage", MakeBaseDocument().dump() + " x", false);
+}
+
+int main() {
+    InstallSimulatedApi("sax_parity_test");
+    TestMutatedDocuments();
+    TestMalformedText();
+    return FinishTests();
+}
\ No newline at end of file
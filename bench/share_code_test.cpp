@@ -0,0 +1,139 @@
+#include "keybind_table.h"
+#include "macro_share_code.h"
+#include "test_support.h"
+#include <random>
+
+// Round-trips randomly generated macros through share codes, then decodes mutated and truncated
+// codes, which must either throw or yield a macro but never crash or read out of bounds.
+
+static std::mt19937 Random(20261018);
+
+static int RandomInt(const int Min, const int Max) { return std::uniform_int_distribution<int>(Min, Max)(Random); }
+
+static int RandomCoordinate() {
+    switch (RandomInt(0, 3)) {
+    case 0:
+        return 0;
+    case 1:
+        return RandomInt(-4096, 4096);
+    case 2:
+        return RandomInt(INT32_MIN, INT32_MAX);
+    default:
+        return RandomInt(0, 1) ? INT32_MAX : INT32_MIN;
+    }
+}
+
+static KeybindAction RandomAction() {
+    const int Delay = RandomInt(0, 3) == 0 ? RandomInt(0, 60000) : RandomInt(0, 100);
+    const EMousePositionType PositionType = RandomInt(0, 1) ? EMousePositionType::Relative : EMousePositionType::Absolute;
+    switch (RandomInt(0, 4)) {
+    case 0:
+    case 1:
+        return {KeybindTable[RandomInt(0, static_cast<int>(KeybindCount) - 1)].Bind, RandomInt(0, 1) == 1, Delay};
+    case 2:
+        if (RandomInt(0, 1))
+            return {static_cast<EMouseButton>(RandomInt(0, 4)), RandomInt(0, 1) == 1, EMousePosition(RandomCoordinate(), RandomCoordinate(), PositionType), Delay};
+        return {static_cast<EMouseButton>(RandomInt(0, 4)), RandomInt(0, 1) == 1, Delay};
+    case 3:
+        return KeybindAction(EMousePosition(RandomCoordinate(), RandomCoordinate(), PositionType), Delay);
+    default:
+        return {static_cast<EWaitCondition>(RandomInt(0, 4)), RandomInt(0, 30000), Delay};
+    }
+}
+
+static Macro RandomMacro() {
+    std::string Name;
+    const int NameLength = RandomInt(1, 128);
+    for (int i = 0; i < NameLength; ++i)
+        Name.push_back(static_cast<char>(RandomInt(1, 255)));
+
+    Macro Result(Name, "");
+    Result.Enabled = RandomInt(0, 1) == 1;
+
+    ActionSequence Actions;
+    const int ActionCount = RandomInt(0, 3) == 0 ? RandomInt(0, 2000) : RandomInt(0, 24);
+    const bool Repetitive = RandomInt(0, 1) == 1;
+    for (int i = 0; i < ActionCount; ++i)
+        Actions.push_back(Repetitive && i >= 4 ? Actions[i % 4] : RandomAction());
+    SetMacroActions(Result, std::move(Actions));
+    return Result;
+}
+
+static bool SameAction(const KeybindAction &Left, const KeybindAction &Right) {
+    if (Left.MacroInputType != Right.MacroInputType || Left.DelayMilliseconds != Right.DelayMilliseconds)
+        return false;
+
+    switch (Left.MacroInputType) {
+    case EMacroInputType::GameBind:
+        return Left.GameBind == Right.GameBind && Left.IsKeybindDown == Right.IsKeybindDown;
+    case EMacroInputType::MouseButton:
+        if (Left.MouseButton != Right.MouseButton || Left.IsKeybindDown != Right.IsKeybindDown || Left.MoveBeforeMouseClick != Right.MoveBeforeMouseClick)
+            return false;
+        return !Left.MoveBeforeMouseClick || (Left.MousePosition.x == Right.MousePosition.x && Left.MousePosition.y == Right.MousePosition.y && Left.MousePosition.MousePositionType == Right.MousePosition.MousePositionType);
+    case EMacroInputType::MouseMove:
+        return Left.MousePosition.x == Right.MousePosition.x && Left.MousePosition.y == Right.MousePosition.y && Left.MousePosition.MousePositionType == Right.MousePosition.MousePositionType;
+    case EMacroInputType::WaitCondition:
+        return Left.WaitCondition == Right.WaitCondition && Left.TimeoutMilliseconds == Right.TimeoutMilliseconds;
+    }
+    return false;
+}
+
+static void TestRoundTrip() {
+    for (int Iteration = 0; Iteration < 2000; ++Iteration) {
+        const Macro Source = RandomMacro();
+        const std::string Code = MacroToShareCode(Source);
+        CHECK(IsShareCode(Code));
+
+        try {
+            const Macro Decoded = ShareCodeToMacro(Code);
+            CHECK(Decoded.Name == Source.Name);
+            CHECK(Decoded.Enabled == Source.Enabled);
+            CHECK(Decoded.ActionCount == Source.ActionCount);
+
+            const auto SourceActions = GetMacroActions(Source);
+            const auto DecodedActions = GetMacroActions(Decoded);
+            CHECK(SourceActions->size() == DecodedActions->size());
+            for (size_t i = 0; i < std::min(SourceActions->size(), DecodedActions->size()); ++i)
+                CHECK(SameAction((*SourceActions)[i], (*DecodedActions)[i]));
+        } catch (const std::exception &e) {
+            std::fprintf(stderr, "round trip %d threw: %s\n", Iteration, e.what());
+            ++TestFailures;
+        }
+    }
+}
+
+static void TestCorruptCodes() {
+    constexpr char Alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_=+/ ";
+    size_t Rejected = 0;
+    for (int Iteration = 0; Iteration < 4000; ++Iteration) {
+        std::string Code = MacroToShareCode(RandomMacro());
+        switch (RandomInt(0, 2)) {
+        case 0:
+            Code.resize(RandomInt(0, static_cast<int>(Code.size())));
+            break;
+        case 1:
+            for (int Flips = RandomInt(1, 4); Flips > 0; --Flips)
+                Code[RandomInt(6, static_cast<int>(Code.size()) - 1)] = Alphabet[RandomInt(0, sizeof(Alphabet) - 2)];
+            break;
+        default:
+            Code.insert(static_cast<size_t>(RandomInt(6, static_cast<int>(Code.size()))), 1, Alphabet[RandomInt(0, 63)]);
+            break;
+        }
+
+        try {
+            const Macro Decoded = ShareCodeToMacro(Code);
+            CHECK(!Decoded.Name.empty() && Decoded.Name.size() <= 128);
+            CHECK(GetMacroActions(Decoded)->size() == Decoded.ActionCount);
+        } catch (const std::exception &) {
+            ++Rejected;
+        }
+    }
+    CHECK(Rejected > 0);
+}
+
+int main() {
+    InstallSimulatedApi("share_code_test");
+    TestRoundTrip();
+    TestCorruptCodes();
+    return FinishTests();
+}
\ No newline at end of file
@@ -0,0 +1,74 @@
+#pragma once
+
+// Minimal stand-in for the MumbleLink header so macro_bench builds natively.
+
+namespace Mumble {
+struct Vector2 {
+    float X;
+    float Y;
+};
+
+struct Vector3 {
+    float X;
+    float Y;
+    float Z;
+};
+
+struct Compass {
+    unsigned short Width;
+    unsigned short Height;
+    float Rotation;
+    Vector2 PlayerPosition;
+    Vector2 Center;
+    float Scale;
+};
+
+enum class EMountIndex : unsigned char {
+    None,
+    Jackal,
+    Griffon,
+    Springer,
+    Skimmer,
+    Raptor,
+    RollerBeetle,
+    Warclaw,
+    Skyscale,
+    Skiff,
+    SiegeTurtle
+};
+
+struct Context {
+    unsigned char ServerAddress[28];
+    unsigned MapID;
+    unsigned MapType;
+    unsigned ShardID;
+    unsigned InstanceID;
+    unsigned BuildID;
+    unsigned IsMapOpen : 1;
+    unsigned IsCompassTopRight : 1;
+    unsigned IsCompassRotating : 1;
+    unsigned IsGameFocused : 1;
+    unsigned IsCompetitive : 1;
+    unsigned IsTextboxFocused : 1;
+    unsigned IsInCombat : 1;
+    struct Compass Compass;
+    unsigned ProcessID;
+    EMountIndex MountIndex;
+};
+
+struct Data {
+    unsigned UIVersion;
+    unsigned UITick;
+    Vector3 AvatarPosition;
+    Vector3 AvatarFront;
+    Vector3 AvatarTop;
+    wchar_t Name[256];
+    Vector3 CameraPosition;
+    Vector3 CameraFront;
+    Vector3 CameraTop;
+    wchar_t Identity[256];
+    unsigned ContextLength;
+    struct Context Context;
+    wchar_t Description[2048];
+};
+} // namespace Mumble
\ No newline at end of file
@@ -0,0 +1,220 @@
+#pragma once
+
+// Minimal stand-in for the Nexus API header so macro_bench builds natively.
+// Only the declarations the addon sources use are provided; enum values are not ABI compatible.
+
+#define NEXUS_API_VERSION 6
+#define DL_MUMBLE_LINK "DL_MUMBLE_LINK"
+#define DL_NEXUS_LINK "DL_NEXUS_LINK"
+
+enum EGameBinds {
+    GB_CameraActionMode,
+    GB_CameraActionModeDisable,
+    GB_CameraFree,
+    GB_CameraReverse,
+    GB_CameraZoomIn,
+    GB_CameraZoomOut,
+    GB_GearLoadout1,
+    GB_GearLoadout2,
+    GB_GearLoadout3,
+    GB_GearLoadout4,
+    GB_GearLoadout5,
+    GB_GearLoadout6,
+    GB_GearLoadout7,
+    GB_GearLoadout8,
+    GB_GearLoadout9,
+    GB_Loadout1,
+    GB_Loadout2,
+    GB_Loadout3,
+    GB_Loadout4,
+    GB_Loadout5,
+    GB_Loadout6,
+    GB_Loadout7,
+    GB_Loadout8,
+    GB_Loadout9,
+    GB_MapFloorDown,
+    GB_MapFloorUp,
+    GB_MapFocusPlayer,
+    GB_MapToggle,
+    GB_MapZoomIn,
+    GB_MapZoomOut,
+    GB_MasteryAccess,
+    GB_MasteryAccess01,
+    GB_MasteryAccess02,
+    GB_MasteryAccess03,
+    GB_MasteryAccess04,
+    GB_MasteryAccess05,
+    GB_MasteryAccess06,
+    GB_MiscAoELoot,
+    GB_MiscCombatStance,
+    GB_MiscInteract,
+    GB_MiscShowAllies,
+    GB_MiscShowEnemies,
+    GB_MiscToggleDecorationMode,
+    GB_MiscToggleFullScreen,
+    GB_MiscToggleLanguage,
+    GB_MiscTogglePetCombat,
+    GB_MoveAboutFace,
+    GB_MoveBackward,
+    GB_MoveDodge,
+    GB_MoveForward,
+    GB_MoveJump_SwimUp_FlyUp,
+    GB_MoveLeft,
+    GB_MoveRight,
+    GB_ScreenshotNormal,
+    GB_ScreenshotStereoscopic,
+    GB_SkillElite,
+    GB_SkillHeal,
+    GB_SkillProfession1,
+    GB_SkillProfession2,
+    GB_SkillProfession3,
+    GB_SkillProfession4,
+    GB_SkillProfession5,
+    GB_SkillProfession6,
+    GB_SkillProfession7,
+    GB_SkillSpecialAction,
+    GB_SkillUtility1,
+    GB_SkillUtility2,
+    GB_SkillUtility3,
+    GB_SkillWeapon1,
+    GB_SkillWeapon2,
+    GB_SkillWeapon3,
+    GB_SkillWeapon4,
+    GB_SkillWeapon5,
+    GB_SkillWeaponSwap,
+    GB_SpumoniMAM01,
+    GB_SpumoniMAM02,
+    GB_SpumoniMAM03,
+    GB_SpumoniMAM04,
+    GB_SpumoniMAM05,
+    GB_SpumoniMAM06,
+    GB_SpumoniMAM07,
+    GB_SpumoniMAM08,
+    GB_SpumoniMAM09,
+    GB_SpumoniMovement,
+    GB_SpumoniSecondaryMovement,
+    GB_SpumoniToggle,
+    GB_TargetAlert,
+    GB_TargetAllyNearest,
+    GB_TargetAllyNext,
+    GB_TargetAllyPrev,
+    GB_TargetAllyTargetingMode,
+    GB_TargetAllyTargetingModeToggle,
+    GB_TargetAutoTargetingDisable,
+    GB_TargetAutoTargetingToggle,
+    GB_TargetCall,
+    GB_TargetCallLocal,
+    GB_TargetEnemyNearest,
+    GB_TargetEnemyNext,
+    GB_TargetEnemyPrev,
+    GB_TargetLock,
+    GB_TargetSnapGroundTarget,
+    GB_TargetSnapGroundTargetToggle,
+    GB_TargetTake,
+    GB_TargetTakeLocal,
+    GB_ToyUseDefault,
+    GB_ToyUseSlot1,
+    GB_ToyUseSlot2,
+    GB_ToyUseSlot3,
+    GB_ToyUseSlot4,
+    GB_ToyUseSlot5,
+    GB_UiChatCommand,
+    GB_UiChatFocus,
+    GB_UiChatReply,
+    GB_UiChatToggle,
+    GB_UiCommerce,
+    GB_UiContacts,
+    GB_UiGuild,
+    GB_UiHero,
+    GB_UiInformation,
+    GB_UiInventory,
+    GB_UiKennel,
+    GB_UiLogout,
+    GB_UiMail,
+    GB_UiOptions,
+    GB_UiParty,
+    GB_UiPvp,
+    GB_UiPvpBuild,
+    GB_UiScoreboard,
+    GB_UiSeasonalObjectivesShop,
+    GB_UiSquadBroadcastChatCommand,
+    GB_UiSquadBroadcastChatFocus,
+    GB_UiSquadBroadcastChatToggle,
+    GB_UiToggle,
+};
+
+enum ELogLevel {
+    LOGL_CRITICAL = 1,
+    LOGL_WARNING,
+    LOGL_INFO,
+    LOGL_DEBUG,
+    LOGL_TRACE
+};
+
+enum ERenderType {
+    RT_PreRender,
+    RT_Render,
+    RT_PostRender,
+    RT_OptionsRender
+};
+
+enum EAddonFlags {
+    AF_None = 0
+};
+
+enum class EUpdateProvider {
+    UP_None = 0,
+    UP_GitHub = 2
+};
+
+typedef void (*GUI_RENDER)();
+typedef void (*INPUTBINDS_PROCESS)(const char *aIdentifier, bool aIsRelease);
+
+struct AddonAPI_t {
+    void *ImguiContext;
+    void *ImguiMalloc;
+    void *ImguiFree;
+    void (*GUI_Register)(ERenderType aRenderType, GUI_RENDER aRenderCallback);
+    void (*GUI_Deregister)(GUI_RENDER aRenderCallback);
+    void (*GUI_SendAlert)(const char *aMessage);
+    const char *(*Paths_GetAddonDirectory)(const char *aName);
+    void (*Log)(ELogLevel aLogLevel, const char *aChannel, const char *aMessage);
+    void *(*DataLink_Get)(const char *aIdentifier);
+    void (*InputBinds_RegisterWithString)(const char *aIdentifier, INPUTBINDS_PROCESS aInputBindHandler, const char *aInputBind);
+    void (*InputBinds_Deregister)(const char *aIdentifier);
+    void (*GameBinds_PressAsync)(EGameBinds aGameBind);
+    void (*GameBinds_ReleaseAsync)(EGameBinds aGameBind);
+    void *(*Textures_GetOrCreateFromResource)(const char *aIdentifier, unsigned aResourceID, void *aModule);
+    void (*QuickAccess_Add)(const char *aIdentifier, const char *aTextureIdentifier, const char *aTextureHoverIdentifier, const char *aKeybindIdentifier, const char *aTooltipText);
+    void (*QuickAccess_Remove)(const char *aIdentifier);
+};
+
+struct NexusLinkData_t {
+    unsigned Width;
+    unsigned Height;
+    float Scaling;
+    bool IsMoving;
+    bool IsCameraMoving;
+    bool IsGameplay;
+};
+
+struct AddonVersion_t {
+    short Major;
+    short Minor;
+    short Build;
+    short Revision;
+};
+
+struct AddonDefinition_t {
+    int Signature;
+    int APIVersion;
+    const char *Name;
+    AddonVersion_t Version;
+    const char *Author;
+    const char *Description;
+    void (*Load)(AddonAPI_t *aApi);
+    void (*Unload)();
+    EAddonFlags Flags;
+    EUpdateProvider Provider;
+    const char *UpdateLink;
+};
\ No newline at end of file
@@ -0,0 +1,51 @@
+#pragma once
+
+// Minimal stand-in for <windows.h> covering the input calls made by the macro executor.
+// Inputs are discarded, so macro_bench runs the executor without touching the desktop.
+
+#include <cstdint>
+
+typedef unsigned long DWORD;
+typedef int BOOL;
+typedef long LONG;
+
+struct POINT {
+    LONG x;
+    LONG y;
+};
+
+struct MOUSEINPUT {
+    LONG dx;
+    LONG dy;
+    DWORD mouseData;
+    DWORD dwFlags;
+    DWORD time;
+    uintptr_t dwExtraInfo;
+};
+
+struct INPUT {
+    DWORD type;
+    MOUSEINPUT mi;
+};
+
+#define INPUT_MOUSE 0
+#define MOUSEEVENTF_LEFTDOWN 0x0002
+#define MOUSEEVENTF_LEFTUP 0x0004
+#define MOUSEEVENTF_RIGHTDOWN 0x0008
+#define MOUSEEVENTF_RIGHTUP 0x0010
+#define MOUSEEVENTF_MIDDLEDOWN 0x0020
+#define MOUSEEVENTF_MIDDLEUP 0x0040
+#define MOUSEEVENTF_XDOWN 0x0080
+#define MOUSEEVENTF_XUP 0x0100
+#define XBUTTON1 0x0001
+#define XBUTTON2 0x0002
+
+inline BOOL GetCursorPos(POINT *Point) {
+    Point->x = 0;
+    Point->y = 0;
+    return 1;
+}
+
+inline BOOL SetCursorPos(int, int) { return 1; }
+
+inline unsigned SendInput(unsigned Count, INPUT *, int) { return Count; }
\ No newline at end of file
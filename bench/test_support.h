@@ -0,0 +1,75 @@
+#pragma once
+
+#include "shared.h"
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+// Shared by the native tests: a CHECK macro that counts failures and a simulated Nexus API
+// whose addon directory is a fresh temporary folder and whose game bind calls are recorded.
+
+inline int TestFailures = 0;
+
+#define CHECK(Condition)                                                                        \
+    do {                                                                                        \
+        if (!(Condition)) {                                                                     \
+            std::fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #Condition); \
+            ++TestFailures;                                                                     \
+        }                                                                                       \
+    } while (0)
+
+struct SimulatedInput {
+    EGameBinds Bind;
+    bool IsPress;
+};
+
+inline std::filesystem::path TestDirectory;
+inline std::vector<SimulatedInput> SimulatedInputs;
+inline std::vector<std::string> SimulatedAlerts;
+
+inline void SimulatedLog(ELogLevel Level, const char *, const char *Message) {
+    if (Level <= LOGL_WARNING)
+        std::fprintf(stderr, "log: %s\n", Message);
+}
+
+inline void SimulatedAlert(const char *Message) { SimulatedAlerts.emplace_back(Message); }
+
+inline void SimulatedPress(const EGameBinds Bind) { SimulatedInputs.push_back({Bind, true}); }
+
+inline void SimulatedRelease(const EGameBinds Bind) { SimulatedInputs.push_back({Bind, false}); }
+
+inline void SimulatedRegisterBind(const char *, INPUTBINDS_PROCESS, const char *) {}
+
+inline void SimulatedDeregisterBind(const char *) {}
+
+inline const char *SimulatedAddonDirectory(const char *Name) {
+    thread_local std::string Path;
+    Path = (TestDirectory / Name).string();
+    return Path.c_str();
+}
+
+inline void InstallSimulatedApi(const char *TestName) {
+    TestDirectory = std::filesystem::temp_directory_path() / (std::string(TestName) + "-" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()));
+    std::filesystem::remove_all(TestDirectory);
+    std::filesystem::create_directories(TestDirectory / "MacroManager");
+
+    static AddonAPI_t SimulatedApi{};
+    SimulatedApi.Log = SimulatedLog;
+    SimulatedApi.GUI_SendAlert = SimulatedAlert;
+    SimulatedApi.GameBinds_PressAsync = SimulatedPress;
+    SimulatedApi.GameBinds_ReleaseAsync = SimulatedRelease;
+    SimulatedApi.Paths_GetAddonDirectory = SimulatedAddonDirectory;
+    SimulatedApi.InputBinds_RegisterWithString = SimulatedRegisterBind;
+    SimulatedApi.InputBinds_Deregister = SimulatedDeregisterBind;
+    ApiDefinition = &SimulatedApi;
+}
+
+inline int FinishTests() {
+    std::error_code Error;
+    std::filesystem::remove_all(TestDirectory, Error);
+    if (TestFailures != 0)
+        std::fprintf(stderr, "%d check(s) failed\n", TestFailures);
+    return TestFailures == 0 ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,414 @@
+#include "action_history.h"
+#include <algorithm>
+#include <climits>
+#include <stdexcept>
+
+using NodePtr = std::shared_ptr<const PersistentActionSequence::Node>;
+
+constexpr size_t MaxLeafActions = 64;
+
+struct PersistentActionSequence::Node {
+    NodePtr Left;
+    NodePtr Right;
+    ActionSequence Actions;
+    size_t Size;
+    int Height;
+};
+
+static size_t SizeOf(const NodePtr &Tree) { return Tree ? Tree->Size : 0; }
+
+static int HeightOf(const NodePtr &Tree) { return Tree ? Tree->Height : 0; }
+
+static NodePtr MakeLeaf(ActionSequence Actions) {
+    const size_t Size = Actions.size();
+    return std::make_shared<const PersistentActionSequence::Node>(PersistentActionSequence::Node{nullptr, nullptr, std::move(Actions), Size, 1});
+}
+
+static NodePtr MakeBranch(NodePtr Left, NodePtr Right) {
+    const size_t Size = SizeOf(Left) + SizeOf(Right);
+    const int Height = std::max(HeightOf(Left), HeightOf(Right)) + 1;
+    return std::make_shared<const PersistentActionSequence::Node>(PersistentActionSequence::Node{std::move(Left), std::move(Right), {}, Size, Height});
+}
+
+static NodePtr Balance(NodePtr Left, NodePtr Right) {
+    if (HeightOf(Left) > HeightOf(Right) + 1) {
+        if (HeightOf(Left->Left) >= HeightOf(Left->Right))
+            return MakeBranch(Left->Left, MakeBranch(Left->Right, std::move(Right)));
+        const NodePtr &Pivot = Left->Right;
+        return MakeBranch(MakeBranch(Left->Left, Pivot->Left), MakeBranch(Pivot->Right, std::move(Right)));
+    }
+
+    if (HeightOf(Right) > HeightOf(Left) + 1) {
+        if (HeightOf(Right->Right) >= HeightOf(Right->Left))
+            return MakeBranch(MakeBranch(std::move(Left), Right->Left), Right->Right);
+        const NodePtr &Pivot = Right->Left;
+        return MakeBranch(MakeBranch(std::move(Left), Pivot->Left), MakeBranch(Pivot->Right, Right->Right));
+    }
+
+    return MakeBranch(std::move(Left), std::move(Right));
+}
+
+static NodePtr BuildBranches(const std::vector<NodePtr> &Leaves, const size_t Begin, const size_t End) {
+    if (End - Begin == 1)
+        return Leaves[Begin];
+    const size_t Middle = Begin + (End - Begin) / 2;
+    return MakeBranch(BuildBranches(Leaves, Begin, Middle), BuildBranches(Leaves, Middle, End));
+}
+
+class LeafWriter {
+public:
+    explicit LeafWriter(const size_t Capacity) {
+        Leaves.reserve((Capacity + MaxLeafActions - 1) / MaxLeafActions);
+        Pending.reserve(MaxLeafActions);
+    }
+
+    void Push(const KeybindAction &Action) {
+        Pending.push_back(Action);
+        ++Count;
+        if (Pending.size() == MaxLeafActions) {
+            Leaves.push_back(MakeLeaf(std::move(Pending)));
+            Pending = ActionSequence();
+            Pending.reserve(MaxLeafActions);
+        }
+    }
+
+    void PushLeaf(const NodePtr &Leaf) {
+        if (!Pending.empty() || Leaf->Size != MaxLeafActions) {
+            for (const KeybindAction &Action : Leaf->Actions)
+                Push(Action);
+            return;
+        }
+        Leaves.push_back(Leaf);
+        Count += MaxLeafActions;
+    }
+
+    size_t size() const { return Count; }
+
+    NodePtr Finish() {
+        if (!Pending.empty())
+            Leaves.push_back(MakeLeaf(std::move(Pending)));
+        return Leaves.empty() ? nullptr : BuildBranches(Leaves, 0, Leaves.size());
+    }
+
+private:
+    std::vector<NodePtr> Leaves;
+    ActionSequence Pending;
+    size_t Count = 0;
+};
+
+static NodePtr Build(const ActionSequence &Actions) {
+    LeafWriter Writer(Actions.size());
+    for (const KeybindAction &Action : Actions)
+        Writer.Push(Action);
+    return Writer.Finish();
+}
+
+template <typename Visitor>
+static void ForEachLeaf(const NodePtr &Tree, Visitor &&Visit) {
+    if (!Tree)
+        return;
+    if (Tree->Left) {
+        ForEachLeaf(Tree->Left, Visit);
+        ForEachLeaf(Tree->Right, Visit);
+        return;
+    }
+    Visit(Tree);
+}
+
+template <typename Visitor>
+static void ForEachLeafFrom(const NodePtr &Tree, Visitor &&Visit) {
+    size_t Begin = 0;
+    ForEachLeaf(Tree, [&](const NodePtr &Leaf) {
+        Visit(Leaf, Begin);
+        Begin += Leaf->Size;
+    });
+}
+
+static bool AnySelected(const std::vector<bool> &Selection, const size_t Begin, const size_t End) {
+    for (size_t i = Begin; i < End; ++i) {
+        if (Selection[i])
+            return true;
+    }
+    return false;
+}
+
+static NodePtr InsertAt(const NodePtr &Tree, const size_t Index, const KeybindAction &Action) {
+    if (!Tree)
+        return MakeLeaf({Action});
+
+    if (!Tree->Left) {
+        ActionSequence Actions = Tree->Actions;
+        Actions.insert(Actions.begin() + static_cast<std::ptrdiff_t>(Index), Action);
+        if (Actions.size() <= MaxLeafActions)
+            return MakeLeaf(std::move(Actions));
+
+        const auto Middle = Actions.begin() + static_cast<std::ptrdiff_t>(Actions.size() / 2);
+        return MakeBranch(MakeLeaf(ActionSequence(Actions.begin(), Middle)), MakeLeaf(ActionSequence(Middle, Actions.end())));
+    }
+
+    const size_t LeftSize = SizeOf(Tree->Left);
+    if (Index <= LeftSize)
+        return Balance(InsertAt(Tree->Left, Index, Action), Tree->Right);
+    return Balance(Tree->Left, InsertAt(Tree->Right, Index - LeftSize, Action));
+}
+
+static NodePtr EraseAt(const NodePtr &Tree, const size_t Index) {
+    if (!Tree->Left) {
+        if (Tree->Size == 1)
+            return nullptr;
+        ActionSequence Actions = Tree->Actions;
+        Actions.erase(Actions.begin() + static_cast<std::ptrdiff_t>(Index));
+        return MakeLeaf(std::move(Actions));
+    }
+
+    const size_t LeftSize = SizeOf(Tree->Left);
+    if (Index < LeftSize) {
+        NodePtr Left = EraseAt(Tree->Left, Index);
+        return Left ? Balance(std::move(Left), Tree->Right) : Tree->Right;
+    }
+    NodePtr Right = EraseAt(Tree->Right, Index - LeftSize);
+    return Right ? Balance(Tree->Left, std::move(Right)) : Tree->Left;
+}
+
+static NodePtr SetAt(const NodePtr &Tree, const size_t Index, const KeybindAction &Action) {
+    if (!Tree->Left) {
+        ActionSequence Actions = Tree->Actions;
+        Actions[Index] = Action;
+        return MakeLeaf(std::move(Actions));
+    }
+
+    const size_t LeftSize = SizeOf(Tree->Left);
+    if (Index < LeftSize)
+        return MakeBranch(SetAt(Tree->Left, Index, Action), Tree->Right);
+    return MakeBranch(Tree->Left, SetAt(Tree->Right, Index - LeftSize, Action));
+}
+
+PersistentActionSequence::PersistentActionSequence(const ActionSequence &Actions) : Root(Build(Actions)) {}
+
+size_t PersistentActionSequence::size() const { return SizeOf(Root); }
+
+const KeybindAction &PersistentActionSequence::At(size_t Index) const {
+    if (Index >= size())
+        throw std::out_of_range("Action index out of range");
+
+    const Node *Tree = Root.get();
+    while (Tree->Left) {
+        const size_t LeftSize = Tree->Left->Size;
+        if (Index < LeftSize) {
+            Tree = Tree->Left.get();
+        } else {
+            Index -= LeftSize;
+            Tree = Tree->Right.get();
+        }
+    }
+    return Tree->Actions[Index];
+}
+
+PersistentActionSequence PersistentActionSequence::Insert(const size_t Index, const KeybindAction &Action) const {
+    if (Index > size())
+        throw std::out_of_range("Action index out of range");
+    return PersistentActionSequence(InsertAt(Root, Index, Action));
+}
+
+PersistentActionSequence PersistentActionSequence::Erase(const size_t Index) const {
+    if (Index >= size())
+        throw std::out_of_range("Action index out of range");
+    return PersistentActionSequence(EraseAt(Root, Index));
+}
+
+PersistentActionSequence PersistentActionSequence::Set(const size_t Index, const KeybindAction &Action) const {
+    if (Index >= size())
+        throw std::out_of_range("Action index out of range");
+    return PersistentActionSequence(SetAt(Root, Index, Action));
+}
+
+PersistentActionSequence PersistentActionSequence::Move(const size_t From, const size_t To) const {
+    const KeybindAction Action = At(From);
+    return Erase(From).Insert(std::min(To, size() - 1), Action);
+}
+
+PersistentActionSequence PersistentActionSequence::EraseSelected(std::vector<bool> &Selection) const {
+    LeafWriter Writer(size());
+    ForEachLeafFrom(Root, [&](const NodePtr &Leaf, const size_t Begin) {
+        if (!AnySelected(Selection, Begin, Begin + Leaf->Size)) {
+            Writer.PushLeaf(Leaf);
+            return;
+        }
+        for (size_t i = 0; i < Leaf->Size; ++i) {
+            if (!Selection[Begin + i])
+                Writer.Push(Leaf->Actions[i]);
+        }
+    });
+
+    Selection.assign(Writer.size(), false);
+    return PersistentActionSequence(Writer.Finish());
+}
+
+PersistentActionSequence PersistentActionSequence::MoveSelected(std::vector<bool> &Selection, const int Offset) const {
+    const size_t Count = Selection.size();
+    LeafWriter Writer(Count);
+    const auto Emit = [&](const KeybindAction &Action, const bool Selected) {
+        Selection[Writer.size()] = Selected;
+        Writer.Push(Action);
+    };
+
+    if (Offset < 0) {
+        const KeybindAction *Held = nullptr;
+        ForEachLeafFrom(Root, [&](const NodePtr &Leaf, const size_t Begin) {
+            const size_t End = Begin + Leaf->Size;
+            if (!Held && !AnySelected(Selection, Begin, End) && (End == Count || !Selection[End])) {
+                Writer.PushLeaf(Leaf);
+                return;
+            }
+            for (size_t i = 0; i < Leaf->Size; ++i) {
+                if (Selection[Begin + i]) {
+                    Emit(Leaf->Actions[i], true);
+                    continue;
+                }
+                if (Held)
+                    Emit(*Held, false);
+                Held = &Leaf->Actions[i];
+            }
+        });
+        if (Held)
+            Emit(*Held, false);
+    } else {
+        std::vector<const KeybindAction *> Run;
+        ForEachLeafFrom(Root, [&](const NodePtr &Leaf, const size_t Begin) {
+            if (Run.empty() && !AnySelected(Selection, Begin, Begin + Leaf->Size)) {
+                Writer.PushLeaf(Leaf);
+                return;
+            }
+            for (size_t i = 0; i < Leaf->Size; ++i) {
+                if (Selection[Begin + i]) {
+                    Run.push_back(&Leaf->Actions[i]);
+                    continue;
+                }
+                Emit(Leaf->Actions[i], false);
+                for (const KeybindAction *Selected : Run)
+                    Emit(*Selected, true);
+                Run.clear();
+            }
+        });
+        for (const KeybindAction *Selected : Run)
+            Emit(*Selected, true);
+    }
+
+    return PersistentActionSequence(Writer.Finish());
+}
+
+PersistentActionSequence PersistentActionSequence::MoveSelectedToEdge(std::vector<bool> &Selection, const bool ToFront) const {
+    LeafWriter Writer(size());
+    size_t SelectedCount = 0;
+    for (const bool TakeSelected : {ToFront, !ToFront}) {
+        ForEachLeafFrom(Root, [&](const NodePtr &Leaf, const size_t Begin) {
+            const bool LeafHasSelected = AnySelected(Selection, Begin, Begin + Leaf->Size);
+            if (!LeafHasSelected) {
+                if (!TakeSelected)
+                    Writer.PushLeaf(Leaf);
+                return;
+            }
+            for (size_t i = 0; i < Leaf->Size; ++i) {
+                if (Selection[Begin + i] == TakeSelected) {
+                    Writer.Push(Leaf->Actions[i]);
+                    SelectedCount += TakeSelected;
+                }
+            }
+        });
+    }
+
+    const size_t Count = Selection.size();
+    Selection.assign(Count, !ToFront);
+    if (ToFront)
+        std::fill_n(Selection.begin(), SelectedCount, true);
+    else
+        std::fill_n(Selection.begin(), Count - SelectedCount, false);
+    return PersistentActionSequence(Writer.Finish());
+}
+
+PersistentActionSequence PersistentActionSequence::DuplicateSelected(std::vector<bool> &Selection) const {
+    const auto LastSelected = std::find(Selection.rbegin(), Selection.rend(), true);
+    if (LastSelected == Selection.rend())
+        return *this;
+    const size_t InsertAfter = static_cast<size_t>(Selection.rend() - LastSelected) - 1;
+
+    std::vector<const KeybindAction *> Copies;
+    LeafWriter Writer(Selection.size() + static_cast<size_t>(std::count(Selection.begin(), Selection.end(), true)));
+    ForEachLeafFrom(Root, [&](const NodePtr &Leaf, const size_t Begin) {
+        const size_t End = Begin + Leaf->Size;
+        if (InsertAfter < Begin || (InsertAfter >= End && !AnySelected(Selection, Begin, End))) {
+            Writer.PushLeaf(Leaf);
+            return;
+        }
+        for (size_t i = 0; i < Leaf->Size; ++i) {
+            Writer.Push(Leaf->Actions[i]);
+            if (Selection[Begin + i])
+                Copies.push_back(&Leaf->Actions[i]);
+            if (Begin + i == InsertAfter) {
+                for (const KeybindAction *Copy : Copies)
+                    Writer.Push(*Copy);
+            }
+        }
+    });
+
+    Selection.assign(Writer.size(), false);
+    std::fill_n(Selection.begin() + static_cast<std::ptrdiff_t>(InsertAfter + 1), Copies.size(), true);
+    return PersistentActionSequence(Writer.Finish());
+}
+
+PersistentActionSequence PersistentActionSequence::ScaleSelectedDelays(const std::vector<bool> &Selection, const int Percent) const {
+    LeafWriter Writer(size());
+    ForEachLeafFrom(Root, [&](const NodePtr &Leaf, const size_t Begin) {
+        if (!AnySelected(Selection, Begin, Begin + Leaf->Size)) {
+            Writer.PushLeaf(Leaf);
+            return;
+        }
+        for (size_t i = 0; i < Leaf->Size; ++i) {
+            KeybindAction Action = Leaf->Actions[i];
+            if (Selection[Begin + i]) {
+                const long long Delay = (static_cast<long long>(Action.DelayMilliseconds) * Percent + 50) / 100;
+                Action.DelayMilliseconds = static_cast<int>(std::clamp(Delay, 0LL, static_cast<long long>(INT_MAX)));
+            }
+            Writer.Push(Action);
+        }
+    });
+
+    return PersistentActionSequence(Writer.Finish());
+}
+
+ActionSequence PersistentActionSequence::ToVector() const {
+    ActionSequence Actions;
+    Actions.reserve(size());
+    ForEachLeaf(Root, [&Actions](const NodePtr &Leaf) { Actions.insert(Actions.end(), Leaf->Actions.begin(), Leaf->Actions.end()); });
+    return Actions;
+}
+
+void ActionHistory::Reset(const ActionSequence &Actions) {
+    Present = PersistentActionSequence(Actions);
+    UndoStack.clear();
+    RedoStack.clear();
+}
+
+void ActionHistory::Apply(PersistentActionSequence Next) {
+    UndoStack.push_back(std::move(Present));
+    Present = std::move(Next);
+    RedoStack.clear();
+}
+
+bool ActionHistory::Undo() {
+    if (UndoStack.empty())
+        return false;
+    RedoStack.push_back(std::move(Present));
+    Present = std::move(UndoStack.back());
+    UndoStack.pop_back();
+    return true;
+}
+
+bool ActionHistory::Redo() {
+    if (RedoStack.empty())
+        return false;
+    UndoStack.push_back(std::move(Present));
+    Present = std::move(RedoStack.back());
+    RedoStack.pop_back();
+    return true;
+}
\ No newline at end of file
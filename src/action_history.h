@@ -0,0 +1,70 @@
+#pragma once
+
+#include "macro.h"
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+class PersistentActionSequence {
+public:
+    PersistentActionSequence() = default;
+
+    explicit PersistentActionSequence(const ActionSequence &Actions);
+
+    size_t size() const;
+
+    bool empty() const { return !Root; }
+
+    const KeybindAction &At(size_t Index) const;
+
+    PersistentActionSequence Insert(size_t Index, const KeybindAction &Action) const;
+
+    PersistentActionSequence PushBack(const KeybindAction &Action) const { return Insert(size(), Action); }
+
+    PersistentActionSequence Erase(size_t Index) const;
+
+    PersistentActionSequence Set(size_t Index, const KeybindAction &Action) const;
+
+    PersistentActionSequence Move(size_t From, size_t To) const;
+
+    PersistentActionSequence EraseSelected(std::vector<bool> &Selection) const;
+
+    PersistentActionSequence MoveSelected(std::vector<bool> &Selection, int Offset) const;
+
+    PersistentActionSequence MoveSelectedToEdge(std::vector<bool> &Selection, bool ToFront) const;
+
+    PersistentActionSequence DuplicateSelected(std::vector<bool> &Selection) const;
+
+    PersistentActionSequence ScaleSelectedDelays(const std::vector<bool> &Selection, int Percent) const;
+
+    ActionSequence ToVector() const;
+
+    struct Node;
+
+private:
+    explicit PersistentActionSequence(std::shared_ptr<const Node> root) : Root(std::move(root)) {}
+
+    std::shared_ptr<const Node> Root;
+};
+
+class ActionHistory {
+public:
+    void Reset(const ActionSequence &Actions);
+
+    const PersistentActionSequence &Current() const { return Present; }
+
+    void Apply(PersistentActionSequence Next);
+
+    bool Undo();
+
+    bool Redo();
+
+    size_t UndoCount() const { return UndoStack.size(); }
+
+    size_t RedoCount() const { return RedoStack.size(); }
+
+private:
+    PersistentActionSequence Present;
+    std::vector<PersistentActionSequence> UndoStack;
+    std::vector<PersistentActionSequence> RedoStack;
+};
\ No newline at end of file
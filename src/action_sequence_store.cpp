@@ -0,0 +1,116 @@
+#include "action_sequence_store.h"
+#include <mutex>
+#include <unordered_map>
+
+struct IdentityHash {
+    size_t operator()(const uint64_t Hash) const { return static_cast<size_t>(Hash); }
+};
+
+static std::mutex StoreMutex;
+static std::unordered_map<uint64_t, std::weak_ptr<const ActionSequence>, IdentityHash> Store;
+static size_t InsertsSinceSweep = 0;
+static uint64_t Lookups = 0;
+static uint64_t Hits = 0;
+
+static void HashValue(uint64_t &Hash, uint64_t Value) {
+    for (int i = 0; i < 8; ++i) {
+        Hash ^= Value & 0xFF;
+        Hash *= 1099511628211ull;
+        Value >>= 8;
+    }
+}
+
+static bool SameAction(const KeybindAction &Left, const KeybindAction &Right) {
+    return Left.MacroInputType == Right.MacroInputType && Left.GameBind == Right.GameBind && Left.MouseButton == Right.MouseButton && Left.MousePosition.x == Right.MousePosition.x && Left.MousePosition.y == Right.MousePosition.y && Left.MousePosition.MousePositionType == Right.MousePosition.MousePositionType && Left.IsKeybindDown == Right.IsKeybindDown && Left.MoveBeforeMouseClick == Right.MoveBeforeMouseClick && Left.DelayMilliseconds == Right.DelayMilliseconds && Left.WaitCondition == Right.WaitCondition && Left.TimeoutMilliseconds == Right.TimeoutMilliseconds;
+}
+
+static bool SameSequence(const ActionSequence &Left, const ActionSequence &Right) {
+    if (Left.size() != Right.size())
+        return false;
+    for (size_t i = 0; i < Left.size(); ++i) {
+        if (!SameAction(Left[i], Right[i]))
+            return false;
+    }
+    return true;
+}
+
+static void SweepExpiredSequences() {
+    for (auto It = Store.begin(); It != Store.end();) {
+        if (It->second.expired())
+            It = Store.erase(It);
+        else
+            ++It;
+    }
+    InsertsSinceSweep = 0;
+}
+
+uint64_t HashActionSequence(const ActionSequence &Actions) {
+    uint64_t Hash = 14695981039346656037ull;
+    HashValue(Hash, Actions.size());
+    for (const auto &Action : Actions) {
+        HashValue(Hash, static_cast<uint64_t>(Action.MacroInputType));
+        HashValue(Hash, static_cast<uint64_t>(Action.GameBind));
+        HashValue(Hash, static_cast<uint64_t>(Action.MouseButton));
+        HashValue(Hash, static_cast<uint32_t>(Action.MousePosition.x));
+        HashValue(Hash, static_cast<uint32_t>(Action.MousePosition.y));
+        HashValue(Hash, static_cast<uint64_t>(Action.MousePosition.MousePositionType));
+        HashValue(Hash, static_cast<uint64_t>(Action.IsKeybindDown) | static_cast<uint64_t>(Action.MoveBeforeMouseClick) << 1);
+        HashValue(Hash, static_cast<uint32_t>(Action.DelayMilliseconds));
+        if (Action.MacroInputType == EMacroInputType::WaitCondition) {
+            HashValue(Hash, static_cast<uint64_t>(Action.WaitCondition));
+            HashValue(Hash, static_cast<uint32_t>(Action.TimeoutMilliseconds));
+        }
+    }
+    return Hash != 0 ? Hash : 1;
+}
+
+std::shared_ptr<const ActionSequence> InternActionSequence(ActionSequence Actions) {
+    const uint64_t Hash = HashActionSequence(Actions);
+
+    std::lock_guard<std::mutex> Lock(StoreMutex);
+    ++Lookups;
+
+    auto &Entry = Store[Hash];
+    if (auto Existing = Entry.lock()) {
+        if (SameSequence(*Existing, Actions)) {
+            ++Hits;
+            return Existing;
+        }
+        return std::make_shared<const ActionSequence>(std::move(Actions));
+    }
+
+    auto Interned = std::make_shared<const ActionSequence>(std::move(Actions));
+    Entry = Interned;
+
+    if (++InsertsSinceSweep >= 1024 && InsertsSinceSweep >= Store.size() / 2)
+        SweepExpiredSequences();
+
+    return Interned;
+}
+
+std::shared_ptr<const ActionSequence> FindActionSequence(const uint64_t Hash) {
+    std::lock_guard<std::mutex> Lock(StoreMutex);
+    ++Lookups;
+
+    const auto It = Store.find(Hash);
+    if (It == Store.end())
+        return nullptr;
+
+    auto Existing = It->second.lock();
+    if (Existing)
+        ++Hits;
+    return Existing;
+}
+
+ActionSequenceStoreStats GetActionSequenceStoreStats() {
+    std::lock_guard<std::mutex> Lock(StoreMutex);
+
+    ActionSequenceStoreStats Stats{0, 0, Lookups, Hits};
+    for (const auto &[Hash, Entry] : Store) {
+        if (const auto Sequence = Entry.lock()) {
+            ++Stats.Sequences;
+            Stats.Actions += Sequence->size();
+        }
+    }
+    return Stats;
+}
\ No newline at end of file
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "macro.h"
+#include <cstdint>
+#include <memory>
+
+struct ActionSequenceStoreStats {
+    size_t Sequences;
+    size_t Actions;
+    uint64_t Lookups;
+    uint64_t Hits;
+};
+
+uint64_t HashActionSequence(const ActionSequence &Actions);
+
+std::shared_ptr<const ActionSequence> InternActionSequence(ActionSequence Actions);
+
+std::shared_ptr<const ActionSequence> FindActionSequence(uint64_t Hash);
+
+ActionSequenceStoreStats GetActionSequenceStoreStats();
\ No newline at end of file
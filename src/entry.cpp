@@ -1,48 +1,59 @@
 #include "./imgui/imgui.h"
 #include "./nexus/Nexus.h"
-#include "game_mode_check.h"
+#include "action_history.h"
+#include "action_sequence_store.h"
+#include "game_state.h"
 #include "keybind_manager.h"
+#include "keybind_search.h"
+#include "keybind_table.h"
 #include "macro_executor.h"
+#include "macro_hot_reload.h"
+#include "macro_journal.h"
 #include "macro_manager.h"
+#include "macro_profile.h"
+#include "macro_profiler.h"
 #include "macro_save.h"
+#include "macro_share_code.h"
+#include "macro_timeline.h"
+#include "macro_view_model.h"
 #include "module.h"
 #include "nlohmann/json.hpp"
 #include "resource.h"
 #include "shared.h"
 #include "string_conversions.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <commdlg.h>
+#include <cstdio>
+#include <cstdlib>
 #include <fstream>
 #include <string>
+#include <vector>
 #include <windows.h>
 
 void RenderMainWindow() {
+    MACRO_PROFILE_SCOPE(EProfileScope::RenderMainWindow);
     if (!ShowMainWindow)
         return;
 
     ImGui::SetNextWindowSize(ImVec2(650, 420), ImGuiCond_FirstUseEver);
     if (ImGui::Begin("Macro Manager", &ShowMainWindow)) {
+        const MacroViewModel &View = GetMacroViewModel();
+
         ImGui::BeginChild("GameModeStatusBanner", ImVec2(0, 40), true);
         {
-            ImVec4 GameModeStatusColor;
-            const char *GameModeStatusText;
-
-            if (IsPlayerInCompetitiveGameMode()) {
-                GameModeStatusColor = ImVec4(1.0f, 0.2f, 0.2f, 1.0f);
-                GameModeStatusText = "COMPETITIVE MODE (PvP/WvW) - MACROS DISABLED";
-            } else {
-                GameModeStatusColor = ImVec4(0.2f, 0.8f, 0.2f, 1.0f);
-                GameModeStatusText = "PvE MODE - MACROS ENABLED";
-            }
+            const ImVec4 GameModeStatusColor = View.IsCompetitive ? ImVec4(1.0f, 0.2f, 0.2f, 1.0f) : ImVec4(0.2f, 0.8f, 0.2f, 1.0f);
 
             ImGui::SetCursorPosY(ImGui::GetCursorPosY() + 8);
-            ImGui::TextColored(GameModeStatusColor, "%s", GameModeStatusText);
+            ImGui::TextColored(GameModeStatusColor, "%s", View.GameModeText);
         }
         ImGui::EndChild();
 
         ImGui::Spacing();
 
         ImGui::Separator();
-        ImGui::Text("Macro Slots (10 total)");
+        ImGui::TextUnformatted(View.MacroCountText.c_str());
         ImGui::TextColored(ImVec4(0.7f, 0.7f, 0.7f, 1.0f), "Assign keybinds through Nexus settings");
 
         ImGui::Spacing();
@@ -56,32 +67,33 @@ void RenderMainWindow() {
                 ImGui::TableSetupColumn("Delete", ImGuiTableColumnFlags_WidthFixed, 70.0f);
                 ImGui::TableHeadersRow();
 
-                for (size_t i = 0; i < Macros.size(); ++i) {
-                    Macro &Macro = Macros[i];
+                for (const MacroRowView &Row : View.Rows) {
                     ImGui::TableNextRow();
 
                     ImGui::TableSetColumnIndex(0);
-                    bool Enabled = Macro.Enabled;
-                    if (ImGui::Checkbox(("##Enabled" + std::to_string(i)).c_str(), &Enabled)) {
-                        Macro.Enabled = Enabled;
-                        SaveMacrosToJson();
+                    bool Enabled = Row.Enabled;
+                    if (ImGui::Checkbox(Row.EnabledLabel.c_str(), &Enabled)) {
+                        if (Macro *Macro = Macros.Get(Row.Handle)) {
+                            Macro->Enabled = Enabled;
+                            Macros.MarkModified();
+                            JournalSetMacroEnabled(Macro->Identifier, Enabled);
+                        }
                     }
 
                     ImGui::TableSetColumnIndex(1);
-                    ImGui::TextUnformatted(Macro.Name.c_str());
+                    ImGui::TextUnformatted(Row.Name.c_str());
 
                     ImGui::TableSetColumnIndex(2);
-                    ImGui::Text("%d actions", static_cast<int>(Macro.Actions.size()));
+                    ImGui::TextUnformatted(Row.ActionsText.c_str());
 
                     ImGui::TableSetColumnIndex(3);
-                    if (ImGui::SmallButton(("Edit##" + std::to_string(i)).c_str()))
-                        OpenMacroEditor(static_cast<int>(i));
+                    if (ImGui::SmallButton(Row.EditLabel.c_str()))
+                        OpenMacroEditor(Row.Handle);
 
                     ImGui::TableSetColumnIndex(4);
-                    if (ImGui::SmallButton(("Delete##" + std::to_string(i)).c_str())) {
-                        DeleteMacro(i);
-                        --i;
-                        SaveMacrosToJson();
+                    if (ImGui::SmallButton(Row.DeleteLabel.c_str())) {
+                        DeleteMacro(Row.Handle);
+                        break;
                     }
                 }
 
@@ -97,11 +109,15 @@ void RenderMainWindow() {
 
         if (ImGui::Button("Import / Export", ImVec2(-1, 0)))
             ShowSaveWindow = true;
+
+        if (ImGui::Button("Execution Timeline", ImVec2(-1, 0)))
+            ShowTimelineWindow = true;
     }
     ImGui::End();
 }
 
 void AddonOptions() {
+    MACRO_PROFILE_SCOPE(EProfileScope::AddonOptions);
     ImGui::SetCurrentContext(
         static_cast<ImGuiContext *>(ApiDefinition->ImguiContext));
 
@@ -119,17 +135,86 @@ void AddonOptions() {
     ImGui::Spacing();
 
     {
-        int ActiveMacros = 0;
-        int TotalMacroActions = 0;
+        const MacroViewModel &View = GetMacroViewModel();
+        ImGui::TextUnformatted(View.ActiveMacrosText.c_str());
+        ImGui::TextUnformatted(View.TotalActionsText.c_str());
+
+        const ActionSequenceStoreStats SequenceStats = GetActionSequenceStoreStats();
+        ImGui::TextColored(ImVec4(0.7f, 0.7f, 0.7f, 1.0f), "Unique Sequences: %d (%d actions in memory)", static_cast<int>(SequenceStats.Sequences), static_cast<int>(SequenceStats.Actions));
+        ImGui::TextColored(ImVec4(0.7f, 0.7f, 0.7f, 1.0f), "Render: %.2f us per frame", GetRenderMicroseconds());
+        ImGui::TextColored(ImVec4(0.7f, 0.7f, 0.7f, 1.0f), "Game Tick: %.2f ms (wait conditions poll at half this)", GetGameStateTickMilliseconds());
+#ifdef MACRO_PROFILER
+        ImGui::Checkbox("Show Addon Profiler", &ShowProfilerWindow);
+#endif
+    }
+
+    ImGui::Spacing();
+
+    if (ImGui::CollapsingHeader("Profiles")) {
+        const auto ActiveProfile = GetActiveMacroProfile();
+        ImGui::Text("Active Profile: %s", ActiveProfile ? ActiveProfile->Name.c_str() : "Default");
+        ImGui::Text("Last Switch: %.2f us", GetLastProfileSwitchMicroseconds());
+        ImGui::TextColored(ImVec4(0.7f, 0.7f, 0.7f, 1.0f), "Character: %s, Map: %u", GetCurrentCharacterName().c_str(), GetCurrentMapID());
+
+        bool ProfilesChanged = false;
+        if (!MacroProfiles.empty() && ImGui::BeginTable("ProfileTable", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+            ImGui::TableSetupColumn("Name", ImGuiTableColumnFlags_WidthStretch);
+            ImGui::TableSetupColumn("Character", ImGuiTableColumnFlags_WidthStretch);
+            ImGui::TableSetupColumn("Map", ImGuiTableColumnFlags_WidthFixed, 60.0f);
+            ImGui::TableSetupColumn("Delete", ImGuiTableColumnFlags_WidthFixed, 70.0f);
+            ImGui::TableHeadersRow();
+
+            for (size_t i = 0; i < MacroProfiles.size(); ++i) {
+                ImGui::TableNextRow();
+
+                ImGui::TableSetColumnIndex(0);
+                ImGui::TextUnformatted(MacroProfiles[i].Name.c_str());
+
+                ImGui::TableSetColumnIndex(1);
+                ImGui::TextUnformatted(MacroProfiles[i].CharacterName.empty() ? "Any" : MacroProfiles[i].CharacterName.c_str());
+
+                ImGui::TableSetColumnIndex(2);
+                if (MacroProfiles[i].MapID != 0)
+                    ImGui::Text("%u", MacroProfiles[i].MapID);
+                else
+                    ImGui::TextUnformatted("Any");
+
+                ImGui::TableSetColumnIndex(3);
+                if (ImGui::SmallButton(("Delete##Profile" + std::to_string(i)).c_str())) {
+                    DeleteMacroProfile(i);
+                    --i;
+                }
+            }
 
-        for (const auto &Macro : Macros) {
-            if (!Macro.Actions.empty() && Macro.Name != "Empty")
-                ++ActiveMacros;
-            TotalMacroActions += static_cast<int>(Macro.Actions.size());
+            ImGui::EndTable();
         }
 
-        ImGui::Text("Active Macros: %d / 10", ActiveMacros);
-        ImGui::Text("Total Actions: %d", TotalMacroActions);
+        static char NewProfileName[64] = "";
+        ImGui::InputText("Profile Name", NewProfileName, sizeof(NewProfileName));
+
+        const bool NameAvailable = NewProfileName[0] && std::none_of(MacroProfiles.begin(), MacroProfiles.end(), [](const MacroProfile &Profile) { return Profile.Name == NewProfileName; });
+        if (ImGui::Button("Add for Current Character") && NameAvailable && !GetCurrentCharacterName().empty()) {
+            MacroProfiles.emplace_back(NewProfileName, GetCurrentCharacterName(), 0);
+            NewProfileName[0] = '\0';
+            ProfilesChanged = true;
+        }
+        ImGui::SameLine();
+        if (ImGui::Button("Add for Current Map") && NameAvailable && GetCurrentMapID() != 0) {
+            MacroProfiles.emplace_back(NewProfileName, "", GetCurrentMapID());
+            NewProfileName[0] = '\0';
+            ProfilesChanged = true;
+        }
+        ImGui::SameLine();
+        if (ImGui::Button("Add for Both") && NameAvailable && !GetCurrentCharacterName().empty() && GetCurrentMapID() != 0) {
+            MacroProfiles.emplace_back(NewProfileName, GetCurrentCharacterName(), GetCurrentMapID());
+            NewProfileName[0] = '\0';
+            ProfilesChanged = true;
+        }
+
+        if (ProfilesChanged) {
+            SaveMacroProfilesToJson();
+            CompileMacroProfiles();
+        }
     }
 
     ImGui::Spacing();
@@ -185,100 +270,247 @@ void AddonOptions() {
     }
 }
 
-struct KeybindEntry {
-    const char *Name;
-    EGameBinds Value;
-};
-
-struct KeybindCategory {
-    const char *Name;
-    const KeybindEntry *Entries;
-    int Count;
-};
-
 static bool KeybindItemsGetter(void *data, int idx, const char **out_text) {
-    *out_text = static_cast<const KeybindEntry *>(data)[idx].Name;
+    *out_text = static_cast<const KeybindInfo *>(data)[idx].Name;
     return true;
 }
 
 void RenderMacroEditorWindow() {
+    MACRO_PROFILE_SCOPE(EProfileScope::RenderMacroEditorWindow);
     if (!ShowEditorWindow)
         return;
 
     static char MacroName[128] = "";
-    static std::vector<KeybindAction> NewMacroActions;
-    static int LastSelectedMacroIndex = -2;
-    static int SelectedMacroSlot = 0;
-
-    if (SelectedMacroIndex != LastSelectedMacroIndex) {
-        if (SelectedMacroIndex >= 0 && SelectedMacroIndex < static_cast<int>(Macros.size())) {
-            const Macro &Macro = Macros[SelectedMacroIndex];
-            strncpy_s(MacroName, sizeof(MacroName), Macro.Name.c_str(), _TRUNCATE);
-            NewMacroActions = Macro.Actions;
-
-            if (const std::string id = Macro.Identifier; id.find("MACRO_") != std::string::npos)
-                SelectedMacroSlot = std::stoi(id.substr(6)) - 1;
+    static std::string MacroProfileName;
+    static ActionHistory EditorHistory;
+    static std::vector<ActionRowView> ActionRows;
+    static uint64_t ActionRowsVersion = 1;
+    static std::vector<bool> ActionSelection;
+    static size_t SelectedActionCount = 0;
+    static int SelectionAnchor = -1;
+    static MacroHandle LastSelectedMacroHandle = InvalidMacroHandle;
+    static bool EditorLoaded = false;
+
+    if (!EditorLoaded || SelectedMacroHandle != LastSelectedMacroHandle) {
+        if (const Macro *Macro = Macros.Get(SelectedMacroHandle)) {
+            strncpy_s(MacroName, sizeof(MacroName), Macro->Name.c_str(), _TRUNCATE);
+            MacroProfileName = Macro->Profile;
+            EditorHistory.Reset(*GetMacroActions(*Macro));
         } else {
             strcpy_s(MacroName, sizeof(MacroName), "New Macro");
-            NewMacroActions.clear();
-            SelectedMacroSlot = 0;
+            MacroProfileName.clear();
+            EditorHistory.Reset({});
         }
-        LastSelectedMacroIndex = SelectedMacroIndex;
+        ++ActionRowsVersion;
+        ActionRows.resize(EditorHistory.Current().size());
+        ActionSelection.assign(EditorHistory.Current().size(), false);
+        SelectedActionCount = 0;
+        SelectionAnchor = -1;
+        LastSelectedMacroHandle = SelectedMacroHandle;
+        EditorLoaded = true;
     }
 
     ImGui::SetNextWindowSize(ImVec2(800, 650), ImGuiCond_FirstUseEver);
     if (ImGui::Begin("Macro Editor", &ShowEditorWindow)) {
         ImGui::InputText("Macro Name", MacroName, sizeof(MacroName));
 
-        ImGui::Separator();
-        const char *MacroSlotNames[10] = {"Slot 1", "Slot 2", "Slot 3", "Slot 4", "Slot 5", "Slot 6", "Slot 7", "Slot 8", "Slot 9", "Slot 10"};
-        ImGui::Combo("Macro Slot", &SelectedMacroSlot, MacroSlotNames, 10);
+        if (ImGui::BeginCombo("Profile", MacroProfileName.empty() ? "All Profiles" : MacroProfileName.c_str())) {
+            if (ImGui::Selectable("All Profiles", MacroProfileName.empty()))
+                MacroProfileName.clear();
+            for (size_t i = 0; i < MacroProfiles.size(); ++i) {
+                ImGui::PushID(static_cast<int>(i));
+                if (ImGui::Selectable(MacroProfiles[i].Name.c_str(), MacroProfiles[i].Name == MacroProfileName))
+                    MacroProfileName = MacroProfiles[i].Name;
+                ImGui::PopID();
+            }
+            ImGui::EndCombo();
+        }
+
+        if (const Macro *Macro = Macros.Get(SelectedMacroHandle))
+            ImGui::TextColored(ImVec4(0.7f, 0.7f, 0.7f, 1.0f), "Keybind: %s", Macro->Identifier.c_str());
+        else
+            ImGui::TextColored(ImVec4(0.7f, 0.7f, 0.7f, 1.0f), "Keybind: assigned on save");
 
         ImGui::Separator();
+        const PersistentActionSequence &EditorActions = EditorHistory.Current();
+        const auto SyncActionRows = [&](const bool ClearSelection) {
+            const size_t Count = EditorHistory.Current().size();
+            ++ActionRowsVersion;
+            ActionRows.resize(Count);
+            if (ClearSelection) {
+                ActionSelection.assign(Count, false);
+                SelectionAnchor = -1;
+            }
+            ActionSelection.resize(Count, false);
+            SelectedActionCount = static_cast<size_t>(std::count(ActionSelection.begin(), ActionSelection.end(), true));
+            if (SelectionAnchor >= static_cast<int>(Count))
+                SelectionAnchor = -1;
+        };
+
         ImGui::Text("Action Sequence:");
-        if (ImGui::BeginChild("ActionList", ImVec2(0, 220), true)) {
-            for (size_t i = 0; i < NewMacroActions.size(); ++i) {
-                ImGui::PushID(static_cast<int>(i));
+        ImGui::SameLine();
+        if (ImGui::SmallButton(("Undo (" + std::to_string(EditorHistory.UndoCount()) + ")").c_str()) && EditorHistory.Undo())
+            SyncActionRows(true);
+        ImGui::SameLine();
+        if (ImGui::SmallButton(("Redo (" + std::to_string(EditorHistory.RedoCount()) + ")").c_str()) && EditorHistory.Redo())
+            SyncActionRows(true);
+        ImGui::SameLine();
+        if (ImGui::SmallButton("Select All")) {
+            ActionSelection.assign(EditorActions.size(), true);
+            SelectedActionCount = EditorActions.size();
+        }
+        ImGui::SameLine();
+        if (ImGui::SmallButton("Select None")) {
+            ActionSelection.assign(EditorActions.size(), false);
+            SelectedActionCount = 0;
+            SelectionAnchor = -1;
+        }
 
-                ImGui::Text("%d.", static_cast<int>(i) + 1);
-                ImGui::SameLine();
+        if (SelectedActionCount > 0) {
+            ImGui::Text("%d selected:", static_cast<int>(SelectedActionCount));
+            ImGui::SameLine();
+            if (ImGui::SmallButton("Delete")) {
+                EditorHistory.Apply(EditorActions.EraseSelected(ActionSelection));
+                SyncActionRows(true);
+            }
+            ImGui::SameLine();
+            if (ImGui::SmallButton("Up")) {
+                EditorHistory.Apply(EditorActions.MoveSelected(ActionSelection, -1));
+                SyncActionRows(false);
+            }
+            ImGui::SameLine();
+            if (ImGui::SmallButton("Down")) {
+                EditorHistory.Apply(EditorActions.MoveSelected(ActionSelection, 1));
+                SyncActionRows(false);
+            }
+            ImGui::SameLine();
+            if (ImGui::SmallButton("To Top")) {
+                EditorHistory.Apply(EditorActions.MoveSelectedToEdge(ActionSelection, true));
+                SyncActionRows(false);
+            }
+            ImGui::SameLine();
+            if (ImGui::SmallButton("To Bottom")) {
+                EditorHistory.Apply(EditorActions.MoveSelectedToEdge(ActionSelection, false));
+                SyncActionRows(false);
+            }
+            ImGui::SameLine();
+            if (ImGui::SmallButton("Duplicate")) {
+                EditorHistory.Apply(EditorActions.DuplicateSelected(ActionSelection));
+                SyncActionRows(false);
+            }
+
+            static int DelayScalePercent = 100;
+            ImGui::SetNextItemWidth(100);
+            ImGui::InputInt("Delay %", &DelayScalePercent);
+            if (DelayScalePercent < 0)
+                DelayScalePercent = 0;
+            ImGui::SameLine();
+            if (ImGui::SmallButton("Scale Delays")) {
+                EditorHistory.Apply(EditorActions.ScaleSelectedDelays(ActionSelection, DelayScalePercent));
+                SyncActionRows(false);
+            }
+        }
+
+        if (ImGui::BeginChild("ActionList", ImVec2(0, 220), true)) {
+            int EraseIndex = -1;
+            int MoveFrom = -1;
+            int MoveTo = -1;
+
+            ImGuiListClipper Clipper;
+            Clipper.Begin(static_cast<int>(EditorActions.size()));
+            while (Clipper.Step()) {
+                for (int i = Clipper.DisplayStart; i < Clipper.DisplayEnd; ++i) {
+                    ActionRowView &Row = ActionRows[i];
+                    if (Row.Version != ActionRowsVersion) {
+                        BuildActionRowView(EditorActions.At(i), Row);
+                        Row.Version = ActionRowsVersion;
+                    }
 
-                if (NewMacroActions[i].MacroInputType == EMacroInputType::MouseMove) {
-                    ImGui::TextColored(ImVec4(0.8f, 0.8f, 0.2f, 1.0f), "MOVE");
+                    ImGui::PushID(i);
+
+                    char RowNumber[16];
+                    snprintf(RowNumber, sizeof(RowNumber), "%d.", i + 1);
+                    if (ImGui::Selectable(RowNumber, ActionSelection[i], 0, ImVec2(40, 0))) {
+                        const ImGuiIO &IO = ImGui::GetIO();
+                        if (IO.KeyShift && SelectionAnchor >= 0) {
+                            ActionSelection.assign(ActionSelection.size(), false);
+                            std::fill(ActionSelection.begin() + std::min(i, SelectionAnchor), ActionSelection.begin() + std::max(i, SelectionAnchor) + 1, true);
+                            SelectedActionCount = static_cast<size_t>(std::abs(i - SelectionAnchor)) + 1;
+                        } else if (IO.KeyCtrl) {
+                            ActionSelection[i] = !ActionSelection[i];
+                            SelectedActionCount += ActionSelection[i] ? 1 : static_cast<size_t>(-1);
+                            SelectionAnchor = i;
+                        } else {
+                            const bool OnlySelection = ActionSelection[i] && SelectedActionCount == 1;
+                            ActionSelection.assign(ActionSelection.size(), false);
+                            ActionSelection[i] = !OnlySelection;
+                            SelectedActionCount = OnlySelection ? 0 : 1;
+                            SelectionAnchor = i;
+                        }
+                    }
                     ImGui::SameLine();
-                    ImGui::TextColored(ImVec4(0.6f, 0.6f, 1.0f, 1.0f), "to (%d, %d) [%s]", NewMacroActions[i].MousePosition.x, NewMacroActions[i].MousePosition.y, NewMacroActions[i].MousePosition.MousePositionType == EMousePositionType::Absolute ? "Abs" : "Rel");
-                } else {
-                    ImGui::TextColored(NewMacroActions[i].IsKeybindDown ? ImVec4(0.2f, 0.8f, 0.2f, 1.0f) : ImVec4(0.8f, 0.2f, 0.2f, 1.0f), "%s", NewMacroActions[i].IsKeybindDown ? "PRESS" : "RELEASE");
+
+                    switch (Row.Kind) {
+                    case EActionRowKind::Move:
+                        ImGui::TextColored(ImVec4(0.8f, 0.8f, 0.2f, 1.0f), "MOVE");
+                        break;
+                    case EActionRowKind::Wait:
+                        ImGui::TextColored(ImVec4(0.2f, 0.7f, 0.8f, 1.0f), "WAIT");
+                        break;
+                    case EActionRowKind::Press:
+                        ImGui::TextColored(ImVec4(0.2f, 0.8f, 0.2f, 1.0f), "PRESS");
+                        break;
+                    case EActionRowKind::Release:
+                        ImGui::TextColored(ImVec4(0.8f, 0.2f, 0.2f, 1.0f), "RELEASE");
+                        break;
+                    }
 
                     ImGui::SameLine();
+                    if (Row.HighlightDetail)
+                        ImGui::TextColored(ImVec4(0.6f, 0.6f, 1.0f, 1.0f), "%s", Row.Detail.c_str());
+                    else
+                        ImGui::TextUnformatted(Row.Detail.c_str());
 
-                    if (NewMacroActions[i].MacroInputType == EMacroInputType::GameBind) {
-                        ImGui::TextUnformatted(GetKeybindName(NewMacroActions[i].GameBind));
-                    } else {
-                        ImGui::TextColored(ImVec4(0.6f, 0.6f, 1.0f, 1.0f), "%s", GetMouseButtonName(NewMacroActions[i].MouseButton));
+                    if (!Row.Position.empty()) {
+                        ImGui::SameLine();
+                        ImGui::TextColored(ImVec4(0.8f, 0.8f, 0.2f, 1.0f), "%s", Row.Position.c_str());
+                    }
 
-                        if (NewMacroActions[i].MoveBeforeMouseClick) {
-                            ImGui::SameLine();
-                            ImGui::TextColored(ImVec4(0.8f, 0.8f, 0.2f, 1.0f), "@ (%d, %d)", NewMacroActions[i].MousePosition.x, NewMacroActions[i].MousePosition.y);
-                        }
+                    if (!Row.Delay.empty()) {
+                        ImGui::SameLine();
+                        ImGui::TextUnformatted(Row.Delay.c_str());
                     }
-                }
 
-                if (NewMacroActions[i].DelayMilliseconds > 0) {
+                    ImGui::SameLine(ImGui::GetWindowWidth() - 100);
+                    if (ImGui::SmallButton("^") && i > 0) {
+                        MoveFrom = i;
+                        MoveTo = i - 1;
+                    }
                     ImGui::SameLine();
-                    ImGui::Text("(%dms delay)", NewMacroActions[i].DelayMilliseconds);
-                }
+                    if (ImGui::SmallButton("v") && i + 1 < static_cast<int>(EditorActions.size())) {
+                        MoveFrom = i;
+                        MoveTo = i + 1;
+                    }
+                    ImGui::SameLine();
+                    if (ImGui::SmallButton("X"))
+                        EraseIndex = i;
 
-                ImGui::SameLine(ImGui::GetWindowWidth() - 60);
-                if (ImGui::SmallButton("X")) {
-                    NewMacroActions.erase(NewMacroActions.begin() + i);
-                    --i;
+                    ImGui::PopID();
                 }
-
-                ImGui::PopID();
+            }
+            Clipper.End();
+
+            if (EraseIndex >= 0) {
+                EditorHistory.Apply(EditorActions.Erase(EraseIndex));
+                ActionSelection.erase(ActionSelection.begin() + EraseIndex);
+                SyncActionRows(false);
+            } else if (MoveFrom >= 0) {
+                EditorHistory.Apply(EditorActions.Move(MoveFrom, MoveTo));
+                std::vector<bool>::swap(ActionSelection[MoveFrom], ActionSelection[MoveTo]);
+                SyncActionRows(false);
             }
 
-            if (NewMacroActions.empty())
+            if (EditorActions.empty())
                 ImGui::TextColored(ImVec4(0.6f, 0.6f, 0.6f, 1.0f), "No actions added yet.");
         }
         ImGui::EndChild();
@@ -287,8 +519,8 @@ void RenderMacroEditorWindow() {
         ImGui::Text("Add Action:");
 
         static int MacroInputTypeIndex = 0;
-        const char *MacroInputTypes[] = {"Keyboard/Game Action", "Mouse Button", "Mouse Move"};
-        ImGui::Combo("Input Type", &MacroInputTypeIndex, MacroInputTypes, 3);
+        const char *MacroInputTypes[] = {"Keyboard/Game Action", "Mouse Button", "Mouse Move", "Wait for Condition"};
+        ImGui::Combo("Input Type", &MacroInputTypeIndex, MacroInputTypes, IM_ARRAYSIZE(MacroInputTypes));
 
         static EGameBinds SelectedKeybind = GB_SkillWeapon1;
         static auto SelectedMouseButton = EMouseButton::Left;
@@ -298,193 +530,46 @@ void RenderMacroEditorWindow() {
         static int MouseY = 0;
         static int MousePositionTypeIndex = 0;
         static bool UseMousePosition = false;
+        static int WaitConditionIndex = 0;
+        static int TimeoutMilliseconds = 10000;
 
         if (MacroInputTypeIndex == 0) {
-            static constexpr KeybindEntry MovementEntries[] = {
-                {"Dodge", GB_MoveDodge},
-                {"Jump / Swim Up / Fly Up", GB_MoveJump_SwimUp_FlyUp},
-                {"About Face", GB_MoveAboutFace},
-            };
-            static constexpr KeybindEntry SkillsEntries[] = {
-                {"Weapon 1", GB_SkillWeapon1},
-                {"Weapon 2", GB_SkillWeapon2},
-                {"Weapon 3", GB_SkillWeapon3},
-                {"Weapon 4", GB_SkillWeapon4},
-                {"Weapon 5", GB_SkillWeapon5},
-                {"Heal", GB_SkillHeal},
-                {"Utility 1", GB_SkillUtility1},
-                {"Utility 2", GB_SkillUtility2},
-                {"Utility 3", GB_SkillUtility3},
-                {"Elite", GB_SkillElite},
-                {"Profession 1", GB_SkillProfession1},
-                {"Profession 2", GB_SkillProfession2},
-                {"Profession 3", GB_SkillProfession3},
-                {"Profession 4", GB_SkillProfession4},
-                {"Profession 5", GB_SkillProfession5},
-                {"Profession 6", GB_SkillProfession6},
-                {"Profession 7", GB_SkillProfession7},
-                {"Weapon Swap", GB_SkillWeaponSwap},
-                {"Special Action", GB_SkillSpecialAction},
-            };
-            static constexpr KeybindEntry TargetingEntries[] = {
-                {"Take Target", GB_TargetTake},
-                {"Call Target", GB_TargetCall},
-                {"Alert", GB_TargetAlert},
-                {"Call Local Target", GB_TargetCallLocal},
-                {"Take Local Target", GB_TargetTakeLocal},
-                {"Nearest Enemy", GB_TargetEnemyNearest},
-                {"Next Enemy", GB_TargetEnemyNext},
-                {"Previous Enemy", GB_TargetEnemyPrev},
-                {"Nearest Ally", GB_TargetAllyNearest},
-                {"Next Ally", GB_TargetAllyNext},
-                {"Previous Ally", GB_TargetAllyPrev},
-                {"Lock Target", GB_TargetLock},
-                {"Snap Ground Target", GB_TargetSnapGroundTarget},
-                {"Snap Ground Target Toggle", GB_TargetSnapGroundTargetToggle},
-                {"Auto-Targeting Disable", GB_TargetAutoTargetingDisable},
-                {"Auto-Targeting Toggle", GB_TargetAutoTargetingToggle},
-                {"Ally Targeting Mode", GB_TargetAllyTargetingMode},
-                {"Ally Targeting Mode Toggle", GB_TargetAllyTargetingModeToggle},
-            };
-            static constexpr KeybindEntry UiEntries[] = {
-                {"Trading Post", GB_UiCommerce},
-                {"Contacts", GB_UiContacts},
-                {"Guild", GB_UiGuild},
-                {"Hero", GB_UiHero},
-                {"Inventory", GB_UiInventory},
-                {"Pets", GB_UiKennel},
-                {"Logout", GB_UiLogout},
-                {"Mail", GB_UiMail},
-                {"Options", GB_UiOptions},
-                {"Party", GB_UiParty},
-                {"PvP", GB_UiPvp},
-                {"PvP Build", GB_UiPvpBuild},
-                {"Scoreboard", GB_UiScoreboard},
-                {"Wizard's Vault", GB_UiSeasonalObjectivesShop},
-                {"Information", GB_UiInformation},
-                {"Chat Toggle", GB_UiChatToggle},
-                {"Chat Command", GB_UiChatCommand},
-                {"Chat Focus", GB_UiChatFocus},
-                {"Chat Reply", GB_UiChatReply},
-                {"UI Toggle", GB_UiToggle},
-                {"Squad Broadcast Chat Toggle", GB_UiSquadBroadcastChatToggle},
-                {"Squad Broadcast Chat Command", GB_UiSquadBroadcastChatCommand},
-                {"Squad Broadcast Chat Focus", GB_UiSquadBroadcastChatFocus},
-            };
-            static constexpr KeybindEntry CameraEntries[] = {
-                {"Free Camera", GB_CameraFree},
-                {"Zoom In", GB_CameraZoomIn},
-                {"Zoom Out", GB_CameraZoomOut},
-                {"Reverse Camera", GB_CameraReverse},
-                {"Action Mode", GB_CameraActionMode},
-                {"Action Mode Disable", GB_CameraActionModeDisable},
-            };
-            static constexpr KeybindEntry ScreenshotEntries[] = {
-                {"Normal Screenshot", GB_ScreenshotNormal},
-                {"Stereoscopic Screenshot", GB_ScreenshotStereoscopic},
-            };
-            static constexpr KeybindEntry MapEntries[] = {
-                {"Toggle Map", GB_MapToggle},
-                {"Focus Player", GB_MapFocusPlayer},
-                {"Floor Down", GB_MapFloorDown},
-                {"Floor Up", GB_MapFloorUp},
-                {"Map Zoom In", GB_MapZoomIn},
-                {"Map Zoom Out", GB_MapZoomOut},
-            };
-            static constexpr KeybindEntry MountEntries[] = {
-                {"Mount / Dismount", GB_SpumoniToggle},
-                {"Mount Ability 1", GB_SpumoniMovement},
-                {"Mount Ability 2", GB_SpumoniSecondaryMovement},
-                {"Raptor", GB_SpumoniMAM01},
-                {"Springer", GB_SpumoniMAM02},
-                {"Skimmer", GB_SpumoniMAM03},
-                {"Jackal", GB_SpumoniMAM04},
-                {"Griffon", GB_SpumoniMAM05},
-                {"Roller Beetle", GB_SpumoniMAM06},
-                {"Warclaw", GB_SpumoniMAM07},
-                {"Skyscale", GB_SpumoniMAM08},
-                {"Siege Turtle", GB_SpumoniMAM09},
-            };
-            static constexpr KeybindEntry MasteryEntries[] = {
-                {"Mastery", GB_MasteryAccess},
-                {"Fishing", GB_MasteryAccess01},
-                {"Skiff", GB_MasteryAccess02},
-                {"Jade Bot Waypoint", GB_MasteryAccess03},
-                {"Rift Scan", GB_MasteryAccess04},
-                {"Skyscale", GB_MasteryAccess05},
-                {"Homestead Doorway", GB_MasteryAccess06},
-            };
-            static constexpr KeybindEntry MiscEntries[] = {
-                {"AoE Loot", GB_MiscAoELoot},
-                {"Interact", GB_MiscInteract},
-                {"Show Enemies", GB_MiscShowEnemies},
-                {"Show Allies", GB_MiscShowAllies},
-                {"Stow / Draw Weapons", GB_MiscCombatStance},
-                {"Toggle Language", GB_MiscToggleLanguage},
-                {"Toggle Pet Combat", GB_MiscTogglePetCombat},
-                {"Toggle Fullscreen", GB_MiscToggleFullScreen},
-                {"Toggle Decorate Mode", GB_MiscToggleDecorationMode},
-            };
-            static constexpr KeybindEntry ToyEntries[] = {
-                {"Default Novelty", GB_ToyUseDefault},
-                {"Chair", GB_ToyUseSlot1},
-                {"Instrument", GB_ToyUseSlot2},
-                {"Held Item", GB_ToyUseSlot3},
-                {"Toy", GB_ToyUseSlot4},
-                {"Tonic", GB_ToyUseSlot5},
-            };
-            static constexpr KeybindEntry BuildTemplateEntries[] = {
-                {"Build Template 1", GB_Loadout1},
-                {"Build Template 2", GB_Loadout2},
-                {"Build Template 3", GB_Loadout3},
-                {"Build Template 4", GB_Loadout4},
-                {"Build Template 5", GB_Loadout5},
-                {"Build Template 6", GB_Loadout6},
-                {"Build Template 7", GB_Loadout7},
-                {"Build Template 8", GB_Loadout8},
-                {"Build Template 9", GB_Loadout9},
-            };
-            static constexpr KeybindEntry EquipmentTemplateEntries[] = {
-                {"Equipment Template 1", GB_GearLoadout1},
-                {"Equipment Template 2", GB_GearLoadout2},
-                {"Equipment Template 3", GB_GearLoadout3},
-                {"Equipment Template 4", GB_GearLoadout4},
-                {"Equipment Template 5", GB_GearLoadout5},
-                {"Equipment Template 6", GB_GearLoadout6},
-                {"Equipment Template 7", GB_GearLoadout7},
-                {"Equipment Template 8", GB_GearLoadout8},
-                {"Equipment Template 9", GB_GearLoadout9},
-            };
-
-            static constexpr KeybindCategory Categories[] = {
-                {"Movement", MovementEntries, IM_ARRAYSIZE(MovementEntries)},
-                {"Skills", SkillsEntries, IM_ARRAYSIZE(SkillsEntries)},
-                {"Targeting", TargetingEntries, IM_ARRAYSIZE(TargetingEntries)},
-                {"UI", UiEntries, IM_ARRAYSIZE(UiEntries)},
-                {"Camera", CameraEntries, IM_ARRAYSIZE(CameraEntries)},
-                {"Screenshots", ScreenshotEntries, IM_ARRAYSIZE(ScreenshotEntries)},
-                {"Map", MapEntries, IM_ARRAYSIZE(MapEntries)},
-                {"Mounts", MountEntries, IM_ARRAYSIZE(MountEntries)},
-                {"Mastery", MasteryEntries, IM_ARRAYSIZE(MasteryEntries)},
-                {"Misc", MiscEntries, IM_ARRAYSIZE(MiscEntries)},
-                {"Toys/Novelties", ToyEntries, IM_ARRAYSIZE(ToyEntries)},
-                {"Build Templates", BuildTemplateEntries, IM_ARRAYSIZE(BuildTemplateEntries)},
-                {"Equipment Templates", EquipmentTemplateEntries, IM_ARRAYSIZE(EquipmentTemplateEntries)},
-            };
             static int CategoryIndex = 0;
             static int ActionIndex = 0;
+            static char KeybindSearch[64] = "";
+
+            ImGui::InputTextWithHint("Search", "Type to find a game bind...", KeybindSearch, sizeof(KeybindSearch));
+            if (KeybindSearch[0] != '\0') {
+                const auto Results = SearchKeybinds(KeybindSearch, 12);
+                if (Results.empty())
+                    ImGui::TextColored(ImVec4(0.7f, 0.7f, 0.7f, 1.0f), "No matching game binds");
+
+                for (const KeybindInfo *Keybind : Results) {
+                    const std::string Label = std::string(Keybind->Name) + "  (" + KeybindCategoryNames[static_cast<int>(Keybind->Category)] + ")##" + Keybind->Identifier;
+                    if (ImGui::Selectable(Label.c_str(), Keybind->Bind == SelectedKeybind)) {
+                        SelectedKeybind = Keybind->Bind;
+                        CategoryIndex = static_cast<int>(Keybind->Category);
+                        ActionIndex = static_cast<int>(std::count_if(std::begin(KeybindTable), Keybind, [Keybind](const KeybindInfo &Other) { return Other.Category == Keybind->Category; }));
+                        KeybindSearch[0] = '\0';
+                    }
+                }
+                ImGui::Separator();
+            }
 
-            if (CategoryIndex >= IM_ARRAYSIZE(Categories))
+            if (CategoryIndex >= IM_ARRAYSIZE(KeybindCategoryNames))
                 CategoryIndex = 0;
-            if (ActionIndex >= Categories[CategoryIndex].Count)
+
+            const auto CategoryBegin = std::find_if(std::begin(KeybindTable), std::end(KeybindTable), [](const KeybindInfo &Keybind) { return static_cast<int>(Keybind.Category) == CategoryIndex; });
+            const auto CategoryEnd = std::find_if(CategoryBegin, std::end(KeybindTable), [](const KeybindInfo &Keybind) { return static_cast<int>(Keybind.Category) != CategoryIndex; });
+            const int CategoryCount = static_cast<int>(CategoryEnd - CategoryBegin);
+            if (ActionIndex >= CategoryCount)
                 ActionIndex = 0;
 
-            const char *CategoryItems = "Movement\0Skills\0Targeting\0UI\0Camera\0Screenshots\0Map\0Mounts\0Mastery\0Misc\0Toys/Novelties\0Build Templates\0Equipment Templates\0";
-            if (ImGui::Combo("Category", &CategoryIndex, CategoryItems))
+            if (ImGui::Combo("Category", &CategoryIndex, KeybindCategoryNames, IM_ARRAYSIZE(KeybindCategoryNames)))
                 ActionIndex = 0;
 
-            if (ImGui::Combo("Action", &ActionIndex, KeybindItemsGetter, const_cast<KeybindEntry *>(Categories[CategoryIndex].Entries), Categories[CategoryIndex].Count))
-                SelectedKeybind = Categories[CategoryIndex].Entries[ActionIndex].Value;
+            if (ImGui::Combo("Action", &ActionIndex, KeybindItemsGetter, const_cast<KeybindInfo *>(CategoryBegin), CategoryCount))
+                SelectedKeybind = CategoryBegin[ActionIndex].Bind;
 
             ImGui::Checkbox("Press (uncheck = Release)", &IsKeybindDown);
         } else if (MacroInputTypeIndex == 1) {
@@ -538,6 +623,15 @@ void RenderMacroEditorWindow() {
             }
 
             ImGui::TextColored(ImVec4(0.7f, 0.7f, 0.7f, 1.0f), "Current position will be: (%d, %d)", MouseX, MouseY);
+        } else if (MacroInputTypeIndex == 3) {
+            const char *WaitConditionNames[] = {"Out of Combat", "In Combat", "Mounted", "Unmounted", "Map Changed"};
+            ImGui::Combo("Condition", &WaitConditionIndex, WaitConditionNames, IM_ARRAYSIZE(WaitConditionNames));
+
+            ImGui::SetNextItemWidth(100);
+            ImGui::InputInt("Timeout (ms)", &TimeoutMilliseconds);
+            if (TimeoutMilliseconds < 0)
+                TimeoutMilliseconds = 0;
+            ImGui::TextColored(ImVec4(0.7f, 0.7f, 0.7f, 1.0f), "The macro stops if the timeout expires first (0 = wait indefinitely).");
         }
 
         ImGui::Spacing();
@@ -545,40 +639,57 @@ void RenderMacroEditorWindow() {
         ImGui::InputInt("Delay (ms)", &DelayMilliseconds);
 
         ImGui::Spacing();
-        if (ImGui::Button("Add Action", ImVec2(120, 0))) {
-            if (MacroInputTypeIndex == 0) {
-                NewMacroActions.emplace_back(SelectedKeybind, IsKeybindDown, DelayMilliseconds);
-            } else if (MacroInputTypeIndex == 1) {
+        const auto BuildEditorAction = [&]() -> KeybindAction {
+            if (MacroInputTypeIndex == 1) {
                 if (UseMousePosition) {
                     const EMousePositionType posType = (MousePositionTypeIndex == 0) ? EMousePositionType::Absolute : EMousePositionType::Relative;
-                    EMousePosition pos(MouseX, MouseY, posType);
-                    NewMacroActions.emplace_back(SelectedMouseButton, IsKeybindDown, pos, DelayMilliseconds);
-                } else {
-                    NewMacroActions.emplace_back(SelectedMouseButton, IsKeybindDown, DelayMilliseconds);
+                    return KeybindAction(SelectedMouseButton, IsKeybindDown, EMousePosition(MouseX, MouseY, posType), DelayMilliseconds);
                 }
-            } else if (MacroInputTypeIndex == 2) {
+                return KeybindAction(SelectedMouseButton, IsKeybindDown, DelayMilliseconds);
+            }
+            if (MacroInputTypeIndex == 2) {
                 const EMousePositionType posType = (MousePositionTypeIndex == 0) ? EMousePositionType::Absolute : EMousePositionType::Relative;
-                EMousePosition pos(MouseX, MouseY, posType);
-                NewMacroActions.emplace_back(pos, DelayMilliseconds);
+                return KeybindAction(EMousePosition(MouseX, MouseY, posType), DelayMilliseconds);
             }
+            if (MacroInputTypeIndex == 3)
+                return KeybindAction(static_cast<EWaitCondition>(WaitConditionIndex), TimeoutMilliseconds, DelayMilliseconds);
+            return KeybindAction(SelectedKeybind, IsKeybindDown, DelayMilliseconds);
+        };
+
+        if (ImGui::Button("Add Action", ImVec2(120, 0))) {
+            EditorHistory.Apply(EditorActions.PushBack(BuildEditorAction()));
+            SyncActionRows(false);
             DelayMilliseconds = 0;
         }
+        if (SelectedActionCount == 1) {
+            ImGui::SameLine();
+            if (ImGui::Button("Replace Selected", ImVec2(120, 0))) {
+                const size_t SelectedIndex = static_cast<size_t>(std::find(ActionSelection.begin(), ActionSelection.end(), true) - ActionSelection.begin());
+                EditorHistory.Apply(EditorActions.Set(SelectedIndex, BuildEditorAction()));
+                SyncActionRows(false);
+                DelayMilliseconds = 0;
+            }
+        }
         ImGui::SameLine();
-        if (ImGui::Button("Clear All", ImVec2(120, 0)))
-            NewMacroActions.clear();
+        if (ImGui::Button("Clear All", ImVec2(120, 0))) {
+            EditorHistory.Apply(PersistentActionSequence());
+            SyncActionRows(true);
+        }
 
         ImGui::Separator();
         if (ImGui::Button("Save Macro", ImVec2(120, 0))) {
-            SaveMacro(MacroName, SelectedMacroSlot, NewMacroActions);
-            NewMacroActions.clear();
-            LastSelectedMacroIndex = -2;
+            SaveMacro(MacroName, SelectedMacroHandle, EditorActions.ToVector(), MacroProfileName);
+            EditorHistory.Reset({});
+            ActionRows.clear();
+            EditorLoaded = false;
         }
         ImGui::SameLine();
         if (ImGui::Button("Cancel", ImVec2(120, 0))) {
-            NewMacroActions.clear();
+            EditorHistory.Reset({});
+            ActionRows.clear();
             ShowEditorWindow = false;
-            SelectedMacroIndex = -1;
-            LastSelectedMacroIndex = -2;
+            SelectedMacroHandle = InvalidMacroHandle;
+            EditorLoaded = false;
         }
     }
     ImGui::End();
@@ -617,18 +728,21 @@ static bool ClipboardSetText(const char *text) {
     return true;
 }
 
-static std::string SaveFileDialog() {
+static const char *JsonFileFilter = "JSON Files (*.json)\0*.json\0All Files (*.*)\0*.*\0";
+static const char *NdjsonFileFilter = "NDJSON Files (*.ndjson)\0*.ndjson\0All Files (*.*)\0*.*\0";
+
+static std::string SaveFileDialog(const char *Filter = JsonFileFilter, const char *DefaultExtension = "json") {
     char MacroSaveFilePath[MAX_PATH] = "";
 
     OPENFILENAME OpenFileName;
     ZeroMemory(&OpenFileName, sizeof(OpenFileName));
     OpenFileName.lStructSize = sizeof(OpenFileName);
     OpenFileName.hwndOwner = nullptr;
-    OpenFileName.lpstrFilter = "JSON Files (*.json)\0*.json\0All Files (*.*)\0*.*\0";
+    OpenFileName.lpstrFilter = Filter;
     OpenFileName.lpstrFile = MacroSaveFilePath;
     OpenFileName.nMaxFile = MAX_PATH;
     OpenFileName.Flags = OFN_EXPLORER | OFN_PATHMUSTEXIST | OFN_OVERWRITEPROMPT;
-    OpenFileName.lpstrDefExt = "json";
+    OpenFileName.lpstrDefExt = DefaultExtension;
 
     if (GetSaveFileName(&OpenFileName))
         return std::string(MacroSaveFilePath);
@@ -636,14 +750,14 @@ static std::string SaveFileDialog() {
     return "";
 }
 
-static std::string OpenFileDialog() {
+static std::string OpenFileDialog(const char *Filter = JsonFileFilter) {
     char MacroSaveFilePath[MAX_PATH] = "";
 
     OPENFILENAME OpenFileName;
     ZeroMemory(&OpenFileName, sizeof(OpenFileName));
     OpenFileName.lStructSize = sizeof(OpenFileName);
     OpenFileName.hwndOwner = nullptr;
-    OpenFileName.lpstrFilter = "JSON Files (*.json)\0*.json\0All Files (*.*)\0*.*\0";
+    OpenFileName.lpstrFilter = Filter;
     OpenFileName.lpstrFile = MacroSaveFilePath;
     OpenFileName.nMaxFile = MAX_PATH;
     OpenFileName.Flags = OFN_EXPLORER | OFN_FILEMUSTEXIST;
@@ -654,11 +768,22 @@ static std::string OpenFileDialog() {
     return "";
 }
 
-static std::string ReadFileToString(const std::string &path) {
-    std::ifstream MacroSaveFile(path, std::ios::binary);
+static bool ReadFileIntoBuffer(const std::string &path, std::string &Buffer) {
+    std::ifstream MacroSaveFile(path, std::ios::binary | std::ios::ate);
     if (!MacroSaveFile.is_open())
-        return "";
-    return std::string((std::istreambuf_iterator<char>(MacroSaveFile)), std::istreambuf_iterator<char>());
+        return false;
+
+    const std::streamoff FileSize = MacroSaveFile.tellg();
+    if (FileSize <= 0)
+        return false;
+
+    Buffer.resize(static_cast<size_t>(FileSize));
+    MacroSaveFile.seekg(0);
+    if (!MacroSaveFile.read(Buffer.data(), FileSize)) {
+        Buffer.clear();
+        return false;
+    }
+    return true;
 }
 
 static bool WriteStringToFile(const std::string &path, const std::string &content) {
@@ -669,7 +794,17 @@ static bool WriteStringToFile(const std::string &path, const std::string &conten
     return true;
 }
 
+static int InputTextResizeCallback(ImGuiInputTextCallbackData *data) {
+    if (data->EventFlag == ImGuiInputTextFlags_CallbackResize) {
+        auto *Buffer = static_cast<std::string *>(data->UserData);
+        Buffer->resize(data->BufTextLen);
+        data->Buf = Buffer->data();
+    }
+    return 0;
+}
+
 void RenderMacroSaveWindow() {
+    MACRO_PROFILE_SCOPE(EProfileScope::RenderMacroSaveWindow);
     if (!ShowSaveWindow)
         return;
 
@@ -677,28 +812,57 @@ void RenderMacroSaveWindow() {
     if (ImGui::Begin("Import / Export Macros", &ShowSaveWindow)) {
         if (ImGui::BeginTabBar("ImportExportTabs")) {
             if (ImGui::BeginTabItem("Export")) {
-                const char *MacroSlotNames[10] = {"Slot 1", "Slot 2", "Slot 3", "Slot 4", "Slot 5", "Slot 6", "Slot 7", "Slot 8", "Slot 9", "Slot 10"};
-                if (ImGui::Combo("Select Macro", &ExportSlot, MacroSlotNames, 10) || LastExportSlot != ExportSlot) {
-                    LastExportSlot = ExportSlot;
-                    const nlohmann::json Json = MacroToJson(Macros[ExportSlot], ExportSlot);
-                    const std::string JsonStrings = Json.dump(2);
-                    strncpy_s(ExportJsonBuffer, JsonStrings.c_str(), sizeof(ExportJsonBuffer) - 1);
+                if (!Macros.Contains(ExportHandle))
+                    ExportHandle = Macros.HandleAt(0);
+
+                const Macro *ExportMacro = Macros.Get(ExportHandle);
+                if (ImGui::BeginCombo("Select Macro", ExportMacro ? ExportMacro->Name.c_str() : "No macros")) {
+                    for (size_t i = 0; i < Macros.size(); ++i) {
+                        ImGui::PushID(static_cast<int>(i));
+                        if (ImGui::Selectable(Macros[i].Name.c_str(), Macros.HandleAt(i) == ExportHandle))
+                            ExportHandle = Macros.HandleAt(i);
+                        ImGui::PopID();
+                    }
+                    ImGui::EndCombo();
+                }
+
+                if (LastExportHandle != ExportHandle || LastExportVersion != Macros.Version()) {
+                    LastExportHandle = ExportHandle;
+                    LastExportVersion = Macros.Version();
+                    if (const Macro *Macro = Macros.Get(ExportHandle)) {
+                        const nlohmann::json Json = MacroToJson(*Macro);
+                        ExportJsonBuffer = Json.dump(2);
+                        ExportShareCode = MacroToShareCode(*Macro);
+                    } else {
+                        ExportJsonBuffer.clear();
+                        ExportShareCode.clear();
+                    }
                 }
 
                 ImGui::Separator();
 
                 ImGui::Text("Macro JSON:");
-                ImGui::InputTextMultiline("##ExportJson", ExportJsonBuffer, sizeof(ExportJsonBuffer), ImVec2(-1, 250), ImGuiInputTextFlags_ReadOnly);
+                ImGui::InputTextMultiline("##ExportJson", ExportJsonBuffer.data(), ExportJsonBuffer.size() + 1, ImVec2(-1, 250), ImGuiInputTextFlags_ReadOnly);
+
+                ImGui::Text("Share Code (%d chars, JSON is %d):", static_cast<int>(ExportShareCode.size()), static_cast<int>(ExportJsonBuffer.size()));
+                ImGui::InputText("##ExportShareCode", ExportShareCode.data(), ExportShareCode.size() + 1, ImGuiInputTextFlags_ReadOnly);
 
                 ImGui::Spacing();
 
                 if (ImGui::Button("Copy to Clipboard", ImVec2(150, 0))) {
-                    if (ClipboardSetText(ExportJsonBuffer))
+                    if (ClipboardSetText(ExportJsonBuffer.c_str()))
                         ShowStatus("Copied to clipboard!");
                     else
                         ShowStatus("Failed to copy to clipboard!");
                 }
                 ImGui::SameLine();
+                if (ImGui::Button("Copy Share Code", ImVec2(150, 0))) {
+                    if (ClipboardSetText(ExportShareCode.c_str()))
+                        ShowStatus("Share code copied to clipboard!");
+                    else
+                        ShowStatus("Failed to copy to clipboard!");
+                }
+                ImGui::SameLine();
                 if (ImGui::Button("Save to File", ImVec2(150, 0))) {
                     std::string MacroSaveFilePath = SaveFileDialog();
                     if (!MacroSaveFilePath.empty()) {
@@ -709,29 +873,79 @@ void RenderMacroSaveWindow() {
                     }
                 }
 
+                ImGui::Separator();
+
+                ImGui::Text("Bulk Export (NDJSON, one macro per line): %d selected", static_cast<int>(BulkExportSelection.size()));
+                ImGui::BeginChild("BulkExportList", ImVec2(0, 120), true);
+                for (size_t i = 0; i < Macros.size(); ++i) {
+                    ImGui::PushID(static_cast<int>(i));
+                    bool Selected = BulkExportSelection.count(Macros[i].Identifier) > 0;
+                    if (ImGui::Checkbox(Macros[i].Name.c_str(), &Selected)) {
+                        if (Selected)
+                            BulkExportSelection.insert(Macros[i].Identifier);
+                        else
+                            BulkExportSelection.erase(Macros[i].Identifier);
+                    }
+                    ImGui::PopID();
+                }
+                ImGui::EndChild();
+
+                if (ImGui::Button("Select All", ImVec2(150, 0))) {
+                    for (const auto &Macro : Macros)
+                        BulkExportSelection.insert(Macro.Identifier);
+                }
+                ImGui::SameLine();
+                if (ImGui::Button("Select None", ImVec2(150, 0)))
+                    BulkExportSelection.clear();
+                ImGui::SameLine();
+                if (ImGui::Button("Export Selected to File", ImVec2(200, 0))) {
+                    std::vector<MacroHandle> Handles;
+                    for (size_t i = 0; i < Macros.size(); ++i) {
+                        if (BulkExportSelection.count(Macros[i].Identifier))
+                            Handles.push_back(Macros.HandleAt(i));
+                    }
+
+                    std::string MacroSaveFilePath = Handles.empty() ? "" : SaveFileDialog(NdjsonFileFilter, "ndjson");
+                    if (Handles.empty()) {
+                        ShowStatus("No macros selected!");
+                    } else if (!MacroSaveFilePath.empty()) {
+                        std::ofstream MacroSaveFile(MacroSaveFilePath, std::ios::binary | std::ios::trunc);
+                        const size_t Exported = MacroSaveFile.is_open() ? ExportMacrosToNdjson(MacroSaveFile, Handles) : 0;
+                        if (Exported == Handles.size())
+                            ShowStatus(("Exported " + std::to_string(Exported) + " macros to: " + MacroSaveFilePath.substr(MacroSaveFilePath.find_last_of("/\\") + 1)).c_str());
+                        else
+                            ShowStatus("Failed to save file!");
+                    }
+                }
+
                 ImGui::EndTabItem();
             }
 
             if (ImGui::BeginTabItem("Import")) {
-                const char *MacroSlotNames[10] = {
-                    "Slot 1", "Slot 2", "Slot 3", "Slot 4", "Slot 5",
-                    "Slot 6", "Slot 7", "Slot 8", "Slot 9", "Slot 10"};
-                ImGui::Combo("Import to Slot", &ImportSlot, MacroSlotNames, 10);
+                const Macro *ImportMacro = Macros.Get(ImportHandle);
+                if (ImGui::BeginCombo("Import to", ImportMacro ? ImportMacro->Name.c_str() : "New Macro")) {
+                    if (ImGui::Selectable("New Macro", !ImportMacro))
+                        ImportHandle = InvalidMacroHandle;
+                    for (size_t i = 0; i < Macros.size(); ++i) {
+                        ImGui::PushID(static_cast<int>(i));
+                        if (ImGui::Selectable(Macros[i].Name.c_str(), Macros.HandleAt(i) == ImportHandle))
+                            ImportHandle = Macros.HandleAt(i);
+                        ImGui::PopID();
+                    }
+                    ImGui::EndCombo();
+                }
 
                 ImGui::Separator();
 
-                ImGui::Text("Paste Macro JSON:");
-                ImGui::InputTextMultiline("##ImportJson", ImportJsonBuffer, sizeof(ImportJsonBuffer),
-                                          ImVec2(-1, 250));
+                ImGui::Text("Paste Macro JSON or Share Code:");
+                ImGui::InputTextMultiline("##ImportJson", ImportJsonBuffer.data(), ImportJsonBuffer.capacity() + 1, ImVec2(-1, 250), ImGuiInputTextFlags_CallbackResize, InputTextResizeCallback, &ImportJsonBuffer);
 
                 ImGui::Spacing();
 
                 if (ImGui::Button("Load from File", ImVec2(150, 0))) {
                     std::string MacroSaveFilePath = OpenFileDialog();
                     if (!MacroSaveFilePath.empty()) {
-                        std::string MacroSaveFileContent = ReadFileToString(MacroSaveFilePath);
-                        if (!MacroSaveFileContent.empty()) {
-                            strncpy_s(ImportJsonBuffer, MacroSaveFileContent.c_str(), sizeof(ImportJsonBuffer));
+                        if (ReadFileIntoBuffer(MacroSaveFilePath, ImportJsonBuffer)) {
                             ShowStatus(("Loaded: " + MacroSaveFilePath.substr(MacroSaveFilePath.find_last_of("/\\") + 1)).c_str());
                         } else {
                             ShowStatus("Failed to read file!");
@@ -740,10 +954,23 @@ void RenderMacroSaveWindow() {
                 }
                 ImGui::SameLine();
                 if (ImGui::Button("Import Macro", ImVec2(150, 0))) {
-                    if (ImportMacroFromJson(ImportJsonBuffer, ImportSlot))
+                    if (ImportMacroFromJson(ImportJsonBuffer, ImportHandle))
                         ShowStatus("Macro imported successfully!");
                     else
-                        ShowStatus("Failed to import: invalid JSON!");
+                        ShowStatus("Failed to import: invalid JSON or share code!");
+                }
+                ImGui::SameLine();
+                if (ImGui::Button("Import NDJSON File", ImVec2(150, 0))) {
+                    std::string MacroSaveFilePath = OpenFileDialog(NdjsonFileFilter);
+                    if (!MacroSaveFilePath.empty()) {
+                        std::ifstream MacroSaveFile(MacroSaveFilePath, std::ios::binary);
+                        if (MacroSaveFile.is_open()) {
+                            const MacroImportSummary Summary = ImportMacrosFromNdjson(MacroSaveFile);
+                            ShowStatus(("Imported " + std::to_string(Summary.Imported) + " macros, " + std::to_string(Summary.Failed) + " invalid").c_str());
+                        } else {
+                            ShowStatus("Failed to read file!");
+                        }
+                    }
                 }
 
                 ImGui::EndTabItem();
@@ -762,17 +989,183 @@ void RenderMacroSaveWindow() {
     ImGui::End();
 }
 
+static ImU32 GetTimelineEventColor(const MacroTimelineEvent &Event) {
+    switch (Event.InputType) {
+    case EMacroInputType::GameBind:
+        return Event.IsKeybindDown ? IM_COL32(80, 200, 80, 255) : IM_COL32(200, 80, 80, 255);
+    case EMacroInputType::MouseButton:
+        return IM_COL32(80, 150, 230, 255);
+    case EMacroInputType::MouseMove:
+        return IM_COL32(170, 170, 170, 255);
+    default:
+        return IM_COL32(230, 200, 60, 255);
+    }
+}
+
+static const char *GetTimelineEventName(const MacroTimelineEvent &Event) {
+    switch (Event.InputType) {
+    case EMacroInputType::GameBind:
+        return GetKeybindName(Event.GameBind);
+    case EMacroInputType::MouseButton:
+        return GetMouseButtonName(Event.MouseButton);
+    case EMacroInputType::MouseMove:
+        return "Mouse Move";
+    default:
+        return GetWaitConditionName(Event.WaitCondition);
+    }
+}
+
+void RenderMacroTimelineWindow() {
+    SetMacroTimelineRecording(ShowTimelineWindow);
+    if (!ShowTimelineWindow)
+        return;
+
+    DrainMacroTimeline();
+
+    static bool Paused = false;
+    static int64_t PausedAtMicroseconds = 0;
+    static int SpanSeconds = 5;
+
+    ImGui::SetNextWindowSize(ImVec2(640, 200), ImGuiCond_FirstUseEver);
+    if (ImGui::Begin("Macro Timeline", &ShowTimelineWindow)) {
+        const MacroTimelineStats &Stats = GetMacroTimelineStats();
+        ImGui::Text("Run %u: %u actions, late by %.1f ms (mean %.1f ms, max %.1f ms)", Stats.Run, Stats.Actions, Stats.LastLatenessMilliseconds, Stats.MeanLatenessMilliseconds, Stats.MaxLatenessMilliseconds);
+        if (Stats.Dropped > 0) {
+            ImGui::SameLine();
+            ImGui::TextColored(ImVec4(1.0f, 0.4f, 0.2f, 1.0f), "%u dropped", Stats.Dropped);
+        }
+
+        if (ImGui::Checkbox("Pause", &Paused) && Paused)
+            PausedAtMicroseconds = GetMacroTimelineMicroseconds(std::chrono::steady_clock::now());
+        ImGui::SameLine();
+        ImGui::SetNextItemWidth(120);
+        ImGui::SliderInt("Span (s)", &SpanSeconds, 1, 30);
+
+        const int64_t RightMicroseconds = Paused ? PausedAtMicroseconds : GetMacroTimelineMicroseconds(std::chrono::steady_clock::now());
+        const int64_t LeftMicroseconds = RightMicroseconds - static_cast<int64_t>(SpanSeconds) * 1000000;
+        const ImVec2 Origin = ImGui::GetCursorScreenPos();
+        const ImVec2 Size(std::max(ImGui::GetContentRegionAvail().x, 100.0f), 90.0f);
+        const float Scale = Size.x / static_cast<float>(RightMicroseconds - LeftMicroseconds);
+        const float ScheduledY = Origin.y + 22.0f;
+        const float ActualY = Origin.y + 68.0f;
+
+        ImGui::InvisibleButton("TimelineCanvas", Size);
+        const bool CanvasHovered = ImGui::IsItemHovered();
+        const float MouseX = ImGui::GetIO().MousePos.x;
+
+        ImDrawList *DrawList = ImGui::GetWindowDrawList();
+        DrawList->AddRectFilled(Origin, ImVec2(Origin.x + Size.x, Origin.y + Size.y), IM_COL32(20, 20, 20, 200));
+        for (int64_t Second = RightMicroseconds / 1000000; Second * 1000000 >= LeftMicroseconds; --Second) {
+            const float x = Origin.x + static_cast<float>(Second * 1000000 - LeftMicroseconds) * Scale;
+            DrawList->AddLine(ImVec2(x, Origin.y), ImVec2(x, Origin.y + Size.y), IM_COL32(60, 60, 60, 255));
+        }
+        DrawList->AddText(ImVec2(Origin.x + 4.0f, ScheduledY - 18.0f), IM_COL32(150, 150, 150, 255), "Scheduled");
+        DrawList->AddText(ImVec2(Origin.x + 4.0f, ActualY + 4.0f), IM_COL32(150, 150, 150, 255), "Actual");
+
+        const MacroTimelineEvent *HoveredEvent = nullptr;
+        float LastScheduledX = -1.0f;
+        float LastActualX = -1.0f;
+        for (size_t i = 0; i < GetMacroTimelineEventCount(); ++i) {
+            const MacroTimelineEvent &Event = GetMacroTimelineEvent(i);
+            if (Event.ActualMicroseconds < LeftMicroseconds)
+                break;
+            if (Event.ActualMicroseconds > RightMicroseconds)
+                continue;
+
+            const float ScheduledX = Origin.x + static_cast<float>(std::max(Event.ScheduledMicroseconds, LeftMicroseconds) - LeftMicroseconds) * Scale;
+            const float ActualX = Origin.x + static_cast<float>(Event.ActualMicroseconds - LeftMicroseconds) * Scale;
+            if (std::fabs(LastScheduledX - ScheduledX) >= 1.0f || std::fabs(LastActualX - ActualX) >= 1.0f) {
+                const ImU32 Color = GetTimelineEventColor(Event);
+                DrawList->AddLine(ImVec2(ScheduledX, ScheduledY), ImVec2(ActualX, ActualY), Color);
+                DrawList->AddRectFilled(ImVec2(ActualX - 2.0f, ActualY - 2.0f), ImVec2(ActualX + 2.0f, ActualY + 2.0f), Color);
+                LastScheduledX = ScheduledX;
+                LastActualX = ActualX;
+            }
+
+            if (CanvasHovered && !HoveredEvent && MouseX >= ActualX - 4.0f && MouseX <= ActualX + 4.0f)
+                HoveredEvent = &Event;
+        }
+
+        if (HoveredEvent) {
+            const double Lateness = static_cast<double>(HoveredEvent->ActualMicroseconds - HoveredEvent->ScheduledMicroseconds) / 1000.0;
+            const char *Direction = HoveredEvent->InputType == EMacroInputType::GameBind || HoveredEvent->InputType == EMacroInputType::MouseButton ? (HoveredEvent->IsKeybindDown ? "PRESS " : "RELEASE ") : "";
+            ImGui::SetTooltip("#%u %s%s\nRun %u, %s %.1f ms", HoveredEvent->ActionIndex + 1, Direction, GetTimelineEventName(*HoveredEvent), HoveredEvent->Run, HoveredEvent->InputType == EMacroInputType::WaitCondition ? "waited" : "late by", Lateness);
+        }
+    }
+    ImGui::End();
+}
+
+static void OnGameStateChanged(const EGameStateEvent Event, const GameState &State) {
+    if (Event == EGameStateEvent::CompetitiveChanged)
+        ApiDefinition->Log(LOGL_INFO, "MacroManager", State.IsCompetitive ? "Entered competitive game mode, macros disabled" : "Left competitive game mode, macros enabled");
+}
+
+#ifdef MACRO_PROFILER
+void RenderProfilerWindow() {
+    UpdateProfileStats();
+    if (!ShowProfilerWindow)
+        return;
+
+    ImGui::SetNextWindowSize(ImVec2(560, 230), ImGuiCond_FirstUseEver);
+    if (ImGui::Begin("Addon Profiler", &ShowProfilerWindow)) {
+        ImGui::TextColored(ImVec4(0.7f, 0.7f, 0.7f, 1.0f), "Rolling timings, updated every second (about 5 s half-life)");
+        if (ImGui::BeginTable("ProfilerTable", 6, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+            ImGui::TableSetupColumn("Scope", ImGuiTableColumnFlags_WidthStretch);
+            ImGui::TableSetupColumn("Calls", ImGuiTableColumnFlags_WidthFixed, 70.0f);
+            ImGui::TableSetupColumn("Min (us)", ImGuiTableColumnFlags_WidthFixed, 70.0f);
+            ImGui::TableSetupColumn("Avg (us)", ImGuiTableColumnFlags_WidthFixed, 70.0f);
+            ImGui::TableSetupColumn("P99 (us)", ImGuiTableColumnFlags_WidthFixed, 70.0f);
+            ImGui::TableSetupColumn("Max (us)", ImGuiTableColumnFlags_WidthFixed, 70.0f);
+            ImGui::TableHeadersRow();
+
+            for (size_t i = 0; i < static_cast<size_t>(EProfileScope::Count); ++i) {
+                const EProfileScope Scope = static_cast<EProfileScope>(i);
+                const ProfileScopeStats &Stats = GetProfileScopeStats(Scope);
+                ImGui::TableNextRow();
+                ImGui::TableSetColumnIndex(0);
+                ImGui::TextUnformatted(GetProfileScopeName(Scope));
+                ImGui::TableSetColumnIndex(1);
+                ImGui::Text("%llu", static_cast<unsigned long long>(Stats.Calls));
+                ImGui::TableSetColumnIndex(2);
+                ImGui::Text("%.2f", Stats.MinMicroseconds);
+                ImGui::TableSetColumnIndex(3);
+                ImGui::Text("%.2f", Stats.AverageMicroseconds);
+                ImGui::TableSetColumnIndex(4);
+                ImGui::Text("%.2f", Stats.P99Microseconds);
+                ImGui::TableSetColumnIndex(5);
+                ImGui::Text("%.2f", Stats.MaxMicroseconds);
+            }
+
+            ImGui::EndTable();
+        }
+    }
+    ImGui::End();
+}
+#endif
+
 void AddonRender() {
+    MACRO_PROFILE_SCOPE(EProfileScope::AddonRender);
+    const auto RenderStart = std::chrono::steady_clock::now();
     ImGui::SetCurrentContext(static_cast<ImGuiContext *>(ApiDefinition->ImguiContext));
+    UpdateActiveMacroProfile();
+    ApplyMacroFileChanges();
     RenderMainWindow();
     RenderMacroEditorWindow();
     RenderMacroSaveWindow();
+    RenderMacroTimelineWindow();
+#ifdef MACRO_PROFILER
+    RenderProfilerWindow();
+#endif
+    RecordRenderMicroseconds(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - RenderStart).count());
 }
 
 void AddonUnload() {
     if (ApiDefinition) {
         KillAllMacros();
-        SaveMacrosToJson();
+        StopGameStateWatcher();
+        UnsubscribeGameState(OnGameStateChanged);
+        StopMacroHotReload();
+        CompactMacroJournal();
 
         for (const auto &Macro : Macros)
             UnregisterKeybind(Macro.Identifier);
@@ -789,6 +1182,9 @@ void AddonUnload() {
 
 void AddonLoad(AddonAPI_t *AddonApi) {
     ApiDefinition = AddonApi;
+    MumbleLink = static_cast<Mumble::Data *>(ApiDefinition->DataLink_Get(DL_MUMBLE_LINK));
+    SubscribeGameState(OnGameStateChanged);
+    StartGameStateWatcher();
     ApiDefinition->Log(LOGL_INFO, "MacroManager", "Macro Keybind Manager v2025.05.02.1230 loaded!");
     ImGui::SetCurrentContext(static_cast<ImGuiContext *>(ApiDefinition->ImguiContext));
     ImGui::SetAllocatorFunctions(reinterpret_cast<void *(*)(size_t, void *)>(ApiDefinition->ImguiMalloc), reinterpret_cast<void (*)(void *, void *)>(ApiDefinition->ImguiFree));
@@ -798,14 +1194,19 @@ void AddonLoad(AddonAPI_t *AddonApi) {
     ApiDefinition->GUI_Register(RT_OptionsRender, AddonOptions);
 
     LoadMacrosFromJson();
+    ReplayMacroJournal();
+    LoadMacroProfilesFromJson();
 
     for (const auto &Macro : Macros)
         UnregisterKeybind(Macro.Identifier);
 
     for (auto &Macro : Macros)
         Macro.Enabled = false;
+    Macros.MarkModified();
 
+    CompileMacroProfiles();
     SetupKeybinds();
+    StartMacroHotReload();
 }
 
 extern "C" __declspec(dllexport) AddonDefinition_t *GetAddonDef() {
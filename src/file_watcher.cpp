@@ -0,0 +1,19 @@
+#include "file_watcher.h"
+
+std::vector<std::string> FileWatcher::TakeChanges() {
+    std::lock_guard<std::mutex> Lock(ChangeMutex);
+    std::vector<std::string> Taken(Changes.begin(), Changes.end());
+    Changes.clear();
+    ChangesPending.store(false, std::memory_order_release);
+    return Taken;
+}
+
+void FileWatcher::PushChange(std::string FileName) {
+    std::lock_guard<std::mutex> Lock(ChangeMutex);
+    Changes.insert(std::move(FileName));
+    ChangesPending.store(true, std::memory_order_release);
+}
+
+#if !defined(_WIN32) && !defined(__linux__)
+std::unique_ptr<FileWatcher> CreateFileWatcher(const std::string &) { return nullptr; }
+#endif
\ No newline at end of file
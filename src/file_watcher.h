@@ -0,0 +1,27 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+class FileWatcher {
+public:
+    virtual ~FileWatcher() = default;
+
+    bool HasChanges() const { return ChangesPending.load(std::memory_order_acquire); }
+
+    std::vector<std::string> TakeChanges();
+
+protected:
+    void PushChange(std::string FileName);
+
+private:
+    std::mutex ChangeMutex;
+    std::unordered_set<std::string> Changes;
+    std::atomic<bool> ChangesPending{false};
+};
+
+std::unique_ptr<FileWatcher> CreateFileWatcher(const std::string &Directory);
\ No newline at end of file
@@ -0,0 +1,73 @@
+#ifdef __linux__
+
+#include "file_watcher.h"
+#include <cerrno>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <thread>
+#include <unistd.h>
+
+class InotifyFileWatcher final : public FileWatcher {
+public:
+    InotifyFileWatcher(const int inotify, const int stop) : InotifyDescriptor(inotify), StopDescriptor(stop), Worker([this] { Run(); }) {}
+
+    ~InotifyFileWatcher() override {
+        const uint64_t Signal = 1;
+        [[maybe_unused]] const ssize_t Written = write(StopDescriptor, &Signal, sizeof(Signal));
+        Worker.join();
+        close(InotifyDescriptor);
+        close(StopDescriptor);
+    }
+
+private:
+    void Run() {
+        alignas(inotify_event) char Buffer[16384];
+        pollfd Descriptors[2] = {{InotifyDescriptor, POLLIN, 0}, {StopDescriptor, POLLIN, 0}};
+
+        while (poll(Descriptors, 2, -1) >= 0 || errno == EINTR) {
+            if (Descriptors[1].revents & POLLIN)
+                break;
+            if (!(Descriptors[0].revents & POLLIN))
+                continue;
+
+            const ssize_t BytesRead = read(InotifyDescriptor, Buffer, sizeof(Buffer));
+            if (BytesRead <= 0)
+                continue;
+
+            for (ssize_t Offset = 0; Offset < BytesRead;) {
+                const auto *Event = reinterpret_cast<const inotify_event *>(Buffer + Offset);
+                if (Event->mask & IN_Q_OVERFLOW)
+                    PushChange("");
+                else if (Event->len > 0)
+                    PushChange(Event->name);
+                Offset += static_cast<ssize_t>(sizeof(inotify_event) + Event->len);
+            }
+        }
+    }
+
+    int InotifyDescriptor;
+    int StopDescriptor;
+    std::thread Worker;
+};
+
+std::unique_ptr<FileWatcher> CreateFileWatcher(const std::string &Directory) {
+    const int InotifyDescriptor = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (InotifyDescriptor < 0)
+        return nullptr;
+
+    if (inotify_add_watch(InotifyDescriptor, Directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_DELETE) < 0) {
+        close(InotifyDescriptor);
+        return nullptr;
+    }
+
+    const int StopDescriptor = eventfd(0, EFD_CLOEXEC);
+    if (StopDescriptor < 0) {
+        close(InotifyDescriptor);
+        return nullptr;
+    }
+
+    return std::make_unique<InotifyFileWatcher>(InotifyDescriptor, StopDescriptor);
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,83 @@
+#ifdef _WIN32
+
+#include "file_watcher.h"
+#include <thread>
+#include <windows.h>
+
+class Win32FileWatcher final : public FileWatcher {
+public:
+    Win32FileWatcher(const HANDLE directory, const HANDLE stop) : DirectoryHandle(directory), StopEvent(stop), Worker([this] { Run(); }) {}
+
+    ~Win32FileWatcher() override {
+        SetEvent(StopEvent);
+        Worker.join();
+        CloseHandle(DirectoryHandle);
+        CloseHandle(StopEvent);
+    }
+
+private:
+    void Run() {
+        OVERLAPPED Overlapped = {};
+        Overlapped.hEvent = CreateEventA(nullptr, TRUE, FALSE, nullptr);
+        if (!Overlapped.hEvent)
+            return;
+
+        alignas(DWORD) char Buffer[16384];
+        while (true) {
+            ResetEvent(Overlapped.hEvent);
+            if (!ReadDirectoryChangesW(DirectoryHandle, Buffer, sizeof(Buffer), FALSE, FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_SIZE, nullptr, &Overlapped, nullptr))
+                break;
+
+            const HANDLE WaitHandles[2] = {Overlapped.hEvent, StopEvent};
+            DWORD BytesReturned = 0;
+            if (WaitForMultipleObjects(2, WaitHandles, FALSE, INFINITE) != WAIT_OBJECT_0) {
+                CancelIo(DirectoryHandle);
+                GetOverlappedResult(DirectoryHandle, &Overlapped, &BytesReturned, TRUE);
+                break;
+            }
+
+            if (!GetOverlappedResult(DirectoryHandle, &Overlapped, &BytesReturned, FALSE))
+                break;
+
+            if (BytesReturned == 0) {
+                PushChange("");
+                continue;
+            }
+
+            for (size_t Offset = 0;;) {
+                const auto *Notification = reinterpret_cast<const FILE_NOTIFY_INFORMATION *>(Buffer + Offset);
+                const int NameLength = static_cast<int>(Notification->FileNameLength / sizeof(WCHAR));
+                const int Size = WideCharToMultiByte(CP_ACP, 0, Notification->FileName, NameLength, nullptr, 0, nullptr, nullptr);
+                std::string FileName(static_cast<size_t>(Size), '\0');
+                WideCharToMultiByte(CP_ACP, 0, Notification->FileName, NameLength, FileName.data(), Size, nullptr, nullptr);
+                PushChange(std::move(FileName));
+
+                if (Notification->NextEntryOffset == 0)
+                    break;
+                Offset += Notification->NextEntryOffset;
+            }
+        }
+
+        CloseHandle(Overlapped.hEvent);
+    }
+
+    HANDLE DirectoryHandle;
+    HANDLE StopEvent;
+    std::thread Worker;
+};
+
+std::unique_ptr<FileWatcher> CreateFileWatcher(const std::string &Directory) {
+    const HANDLE DirectoryHandle = CreateFileA(Directory.c_str(), FILE_LIST_DIRECTORY, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+    if (DirectoryHandle == INVALID_HANDLE_VALUE)
+        return nullptr;
+
+    const HANDLE StopEvent = CreateEventA(nullptr, TRUE, FALSE, nullptr);
+    if (!StopEvent) {
+        CloseHandle(DirectoryHandle);
+        return nullptr;
+    }
+
+    return std::make_unique<Win32FileWatcher>(DirectoryHandle, StopEvent);
+}
+
+#endif
\ No newline at end of file
@@ -1,20 +1,7 @@
 #include "game_mode_check.h"
-#include "mumble/Mumble.h"
-#include "shared.h"
+#include "game_state.h"
 
-bool IsPlayerInCompetitiveGameMode() {
-    if (!ApiDefinition)
-        return false;
-
-    const auto MumbleLinkData = static_cast<Mumble::Data *>(
-        ApiDefinition->DataLink_Get(DL_MUMBLE_LINK));
-
-    if (MumbleLinkData) {
-        return MumbleLinkData->Context.IsCompetitive;
-    }
-
-    return false;
-}
+bool IsPlayerInCompetitiveGameMode() { return GetGameState().IsCompetitive; }
 
 bool IsPlayerInPlayerVersusEnvironmentGameMode() {
     return !IsPlayerInCompetitiveGameMode();
@@ -0,0 +1,197 @@
+#include "game_state.h"
+#include "shared.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+constexpr uint32_t StateMountMask = 0xFF;
+constexpr uint32_t StateCompetitive = 1u << 8;
+constexpr uint32_t StateInCombat = 1u << 9;
+constexpr size_t MaxGameStateSubscribers = 8;
+constexpr uint32_t MinSampleMicroseconds = 2000;
+constexpr uint32_t MaxSampleMicroseconds = 50000;
+constexpr uint32_t MaxTickSampleMicroseconds = 250000;
+
+static std::atomic<uint32_t> StateSequence{0};
+static std::atomic<uint32_t> StateUITick{0};
+static std::atomic<uint32_t> StateMapID{0};
+static std::atomic<uint32_t> StateMapType{0};
+static std::atomic<uint64_t> StateCharacterHash{0};
+static std::atomic<uint32_t> StateFlags{0};
+static std::atomic<uint32_t> EventCounts[static_cast<size_t>(EGameStateEvent::Count)];
+static std::atomic<GameStateCallback> Subscribers[MaxGameStateSubscribers];
+static std::atomic<uint32_t> TickMicroseconds{16667};
+static bool HasPublishedState = false;
+static std::chrono::steady_clock::time_point LastTickTime;
+
+static std::mutex TickMutex;
+static std::condition_variable TickSignal;
+
+static std::thread WatcherThread;
+static std::mutex WatcherMutex;
+static std::condition_variable WatcherSignal;
+static bool WatcherStopping = false;
+
+static uint64_t HashCharacterName(const wchar_t *Identity, const size_t Capacity) {
+    static constexpr wchar_t NameKey[] = L"\"name\":\"";
+    constexpr size_t NameKeyLength = sizeof(NameKey) / sizeof(wchar_t) - 1;
+
+    uint64_t Hash = 14695981039346656037ull;
+    for (size_t i = 0; i + NameKeyLength < Capacity && Identity[i] != L'\0'; ++i) {
+        size_t Matched = 0;
+        while (Matched < NameKeyLength && Identity[i + Matched] == NameKey[Matched])
+            ++Matched;
+        if (Matched != NameKeyLength)
+            continue;
+
+        for (size_t j = i + NameKeyLength; j < Capacity && Identity[j] != L'\0' && Identity[j] != L'"'; ++j) {
+            Hash ^= static_cast<uint32_t>(Identity[j]);
+            Hash *= 1099511628211ull;
+        }
+        return Hash;
+    }
+    return 0;
+}
+
+static void PublishGameStateEvent(const EGameStateEvent Event, const GameState &State) {
+    EventCounts[static_cast<size_t>(Event)].fetch_add(1, std::memory_order_release);
+    for (auto &Subscriber : Subscribers) {
+        if (const GameStateCallback Callback = Subscriber.load(std::memory_order_acquire))
+            Callback(Event, State);
+    }
+}
+
+void UpdateGameState() {
+    const Mumble::Data *Link = MumbleLink;
+    if (!Link)
+        return;
+
+    const uint32_t UITick = Link->UITick;
+    if (HasPublishedState && UITick == StateUITick.load(std::memory_order_relaxed))
+        return;
+
+    const GameState Previous = GetGameState();
+    GameState Current;
+    Current.UITick = UITick;
+    Current.MapID = Link->Context.MapID;
+    Current.MapType = Link->Context.MapType;
+    Current.CharacterHash = HashCharacterName(Link->Identity, sizeof(Link->Identity) / sizeof(wchar_t));
+    Current.IsCompetitive = Link->Context.IsCompetitive;
+    Current.IsInCombat = Link->Context.IsInCombat;
+    Current.Mount = Link->Context.MountIndex;
+
+    const uint32_t Flags = static_cast<uint32_t>(Current.Mount) | (Current.IsCompetitive ? StateCompetitive : 0) | (Current.IsInCombat ? StateInCombat : 0);
+    const uint32_t Sequence = StateSequence.load(std::memory_order_relaxed);
+    StateSequence.store(Sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    StateUITick.store(Current.UITick, std::memory_order_relaxed);
+    StateMapID.store(Current.MapID, std::memory_order_relaxed);
+    StateMapType.store(Current.MapType, std::memory_order_relaxed);
+    StateCharacterHash.store(Current.CharacterHash, std::memory_order_relaxed);
+    StateFlags.store(Flags, std::memory_order_relaxed);
+    StateSequence.store(Sequence + 2, std::memory_order_release);
+
+    const auto Now = std::chrono::steady_clock::now();
+    if (HasPublishedState) {
+        const auto Sample = static_cast<uint32_t>(std::min<int64_t>(std::chrono::duration_cast<std::chrono::microseconds>(Now - LastTickTime).count(), MaxTickSampleMicroseconds));
+        const uint32_t Estimate = TickMicroseconds.load(std::memory_order_relaxed);
+        TickMicroseconds.store(Estimate - Estimate / 8 + Sample / 8, std::memory_order_relaxed);
+    }
+    LastTickTime = Now;
+
+    {
+        std::lock_guard<std::mutex> Lock(TickMutex);
+    }
+    TickSignal.notify_all();
+
+    const bool FirstSample = !HasPublishedState;
+    HasPublishedState = true;
+    if (FirstSample)
+        return;
+
+    if (Current.IsCompetitive != Previous.IsCompetitive)
+        PublishGameStateEvent(EGameStateEvent::CompetitiveChanged, Current);
+    if (Current.MapID != Previous.MapID)
+        PublishGameStateEvent(EGameStateEvent::MapChanged, Current);
+    if (Current.CharacterHash != Previous.CharacterHash)
+        PublishGameStateEvent(EGameStateEvent::CharacterChanged, Current);
+    if (Current.Mount != Previous.Mount)
+        PublishGameStateEvent(EGameStateEvent::MountChanged, Current);
+}
+
+GameState GetGameState() {
+    GameState State;
+    uint32_t Before;
+    uint32_t Flags;
+    do {
+        Before = StateSequence.load(std::memory_order_acquire);
+        State.UITick = StateUITick.load(std::memory_order_relaxed);
+        State.MapID = StateMapID.load(std::memory_order_relaxed);
+        State.MapType = StateMapType.load(std::memory_order_relaxed);
+        State.CharacterHash = StateCharacterHash.load(std::memory_order_relaxed);
+        Flags = StateFlags.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+    } while ((Before & 1) != 0 || Before != StateSequence.load(std::memory_order_relaxed));
+
+    State.IsCompetitive = (Flags & StateCompetitive) != 0;
+    State.IsInCombat = (Flags & StateInCombat) != 0;
+    State.Mount = static_cast<Mumble::EMountIndex>(Flags & StateMountMask);
+    return State;
+}
+
+uint32_t GetGameStateEventCount(const EGameStateEvent Event) { return EventCounts[static_cast<size_t>(Event)].load(std::memory_order_acquire); }
+
+uint32_t WaitForGameStateTick(const uint32_t LastTick, const std::chrono::milliseconds MaxWait) {
+    std::unique_lock<std::mutex> Lock(TickMutex);
+    TickSignal.wait_for(Lock, MaxWait, [LastTick] { return StateUITick.load(std::memory_order_acquire) != LastTick; });
+    return StateUITick.load(std::memory_order_acquire);
+}
+
+double GetGameStateTickMilliseconds() { return TickMicroseconds.load(std::memory_order_relaxed) / 1000.0; }
+
+bool SubscribeGameState(const GameStateCallback Callback) {
+    for (auto &Subscriber : Subscribers) {
+        GameStateCallback Expected = nullptr;
+        if (Subscriber.compare_exchange_strong(Expected, Callback, std::memory_order_acq_rel))
+            return true;
+    }
+    return false;
+}
+
+void UnsubscribeGameState(const GameStateCallback Callback) {
+    for (auto &Subscriber : Subscribers) {
+        GameStateCallback Expected = Callback;
+        Subscriber.compare_exchange_strong(Expected, nullptr, std::memory_order_acq_rel);
+    }
+}
+
+void StartGameStateWatcher() {
+    if (WatcherThread.joinable())
+        return;
+
+    UpdateGameState();
+    WatcherStopping = false;
+    WatcherThread = std::thread([] {
+        std::unique_lock<std::mutex> Lock(WatcherMutex);
+        while (!WatcherSignal.wait_for(Lock, std::chrono::microseconds(std::clamp(TickMicroseconds.load(std::memory_order_relaxed) / 2, MinSampleMicroseconds, MaxSampleMicroseconds)), [] { return WatcherStopping; })) {
+            Lock.unlock();
+            UpdateGameState();
+            Lock.lock();
+        }
+    });
+}
+
+void StopGameStateWatcher() {
+    if (!WatcherThread.joinable())
+        return;
+
+    {
+        std::lock_guard<std::mutex> Lock(WatcherMutex);
+        WatcherStopping = true;
+    }
+    WatcherSignal.notify_all();
+    WatcherThread.join();
+}
\ No newline at end of file
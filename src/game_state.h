@@ -0,0 +1,43 @@
+#pragma once
+
+#include "mumble/Mumble.h"
+#include <chrono>
+#include <cstdint>
+
+struct GameState {
+    uint32_t UITick;
+    uint32_t MapID;
+    uint32_t MapType;
+    uint64_t CharacterHash;
+    bool IsCompetitive;
+    bool IsInCombat;
+    Mumble::EMountIndex Mount;
+};
+
+enum class EGameStateEvent {
+    CompetitiveChanged,
+    MapChanged,
+    CharacterChanged,
+    MountChanged,
+    Count
+};
+
+using GameStateCallback = void (*)(EGameStateEvent Event, const GameState &State);
+
+void UpdateGameState();
+
+GameState GetGameState();
+
+uint32_t GetGameStateEventCount(EGameStateEvent Event);
+
+uint32_t WaitForGameStateTick(uint32_t LastTick, std::chrono::milliseconds MaxWait);
+
+double GetGameStateTickMilliseconds();
+
+bool SubscribeGameState(GameStateCallback Callback);
+
+void UnsubscribeGameState(GameStateCallback Callback);
+
+void StartGameStateWatcher();
+
+void StopGameStateWatcher();
\ No newline at end of file
@@ -1,9 +1,12 @@
 #include "keybind_manager.h"
 #include "macro_executor.h"
+#include "macro_profile.h"
+#include "macro_profiler.h"
 #include "shared.h"
 #include <cstring>
 
 void ProcessKeybind(const char *ActionIdentifier, const bool ActionIsRelease) {
+    MACRO_PROFILE_SCOPE(EProfileScope::ProcessKeybind);
     if (ActionIsRelease)
         return;
 
@@ -23,12 +26,8 @@ void ProcessKeybind(const char *ActionIdentifier, const bool ActionIsRelease) {
             return;
         }
 
-        for (const auto &Macro : Macros) {
-            if (Macro.Identifier == ActionIdentifier) {
-                ExecuteMacro(Macro);
-                break;
-            }
-        }
+        if (const std::shared_ptr<const Macro> Macro = FindActiveMacro(ActionIdentifier))
+            ExecuteMacro(*Macro);
         MacroMutex.unlock();
     } else {
         if (ApiDefinition) {
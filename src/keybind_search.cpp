@@ -0,0 +1,150 @@
+#include "keybind_search.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+struct KeybindSearchIndex {
+    std::string Names[KeybindCount];
+    std::string Texts[KeybindCount];
+    std::unordered_map<uint32_t, std::vector<uint16_t>> Trigrams;
+};
+
+struct KeybindMatch {
+    int Score;
+    uint16_t Index;
+};
+
+static std::string ToSearchText(const std::string_view Text) {
+    std::string Result;
+    Result.reserve(Text.size());
+    for (const char Character : Text) {
+        if (std::isalnum(static_cast<unsigned char>(Character)))
+            Result.push_back(static_cast<char>(std::tolower(static_cast<unsigned char>(Character))));
+        else if (!Result.empty() && Result.back() != ' ')
+            Result.push_back(' ');
+    }
+    while (!Result.empty() && Result.back() == ' ')
+        Result.pop_back();
+    return Result;
+}
+
+static uint32_t PackTrigram(const std::string &Text, const size_t Position) {
+    return static_cast<uint32_t>(static_cast<unsigned char>(Text[Position])) << 16 | static_cast<uint32_t>(static_cast<unsigned char>(Text[Position + 1])) << 8 | static_cast<unsigned char>(Text[Position + 2]);
+}
+
+static std::vector<uint32_t> GetTrigrams(const std::string &Text) {
+    std::vector<uint32_t> Trigrams;
+    for (size_t i = 0; i + 3 <= Text.size(); ++i)
+        Trigrams.push_back(PackTrigram(Text, i));
+    std::sort(Trigrams.begin(), Trigrams.end());
+    Trigrams.erase(std::unique(Trigrams.begin(), Trigrams.end()), Trigrams.end());
+    return Trigrams;
+}
+
+static KeybindSearchIndex BuildKeybindSearchIndex() {
+    KeybindSearchIndex Index;
+    for (size_t i = 0; i < KeybindCount; ++i) {
+        Index.Names[i] = ToSearchText(KeybindTable[i].Name);
+        Index.Texts[i] = Index.Names[i] + ' ' + ToSearchText(KeybindCategoryNames[static_cast<int>(KeybindTable[i].Category)]);
+        for (const uint32_t Trigram : GetTrigrams(Index.Texts[i]))
+            Index.Trigrams[Trigram].push_back(static_cast<uint16_t>(i));
+    }
+    return Index;
+}
+
+static const KeybindSearchIndex &GetKeybindSearchIndex() {
+    static const KeybindSearchIndex Index = BuildKeybindSearchIndex();
+    return Index;
+}
+
+static bool HasWordPrefix(const std::string &Text, const std::string &Prefix) {
+    for (size_t Position = Text.find(Prefix); Position != std::string::npos; Position = Text.find(Prefix, Position + 1)) {
+        if (Position == 0 || Text[Position - 1] == ' ')
+            return true;
+    }
+    return false;
+}
+
+static bool HasAllWordPrefixes(const std::string &Text, const std::string &Query) {
+    size_t Start = 0;
+    while (Start < Query.size()) {
+        size_t End = Query.find(' ', Start);
+        if (End == std::string::npos)
+            End = Query.size();
+        if (!HasWordPrefix(Text, Query.substr(Start, End - Start)))
+            return false;
+        Start = End + 1;
+    }
+    return true;
+}
+
+static int ScoreKeybind(const std::string &Name, const std::string &Text, const std::string &Query) {
+    if (Name == Query)
+        return 1000;
+    if (Name.compare(0, Query.size(), Query) == 0)
+        return 800;
+    if (HasWordPrefix(Name, Query))
+        return 600;
+    if (HasWordPrefix(Text, Query))
+        return 500;
+    if (Text.find(Query) != std::string::npos)
+        return 400;
+    if (Query.find(' ') != std::string::npos && HasAllWordPrefixes(Text, Query))
+        return 350;
+    return 0;
+}
+
+std::vector<const KeybindInfo *> SearchKeybinds(const std::string_view Query, const size_t MaxResults) {
+    const KeybindSearchIndex &Index = GetKeybindSearchIndex();
+    const std::string SearchText = ToSearchText(Query);
+    if (SearchText.empty() || MaxResults == 0)
+        return {};
+
+    int Scores[KeybindCount] = {};
+    if (SearchText.size() < 3) {
+        for (size_t i = 0; i < KeybindCount; ++i)
+            Scores[i] = ScoreKeybind(Index.Names[i], Index.Texts[i], SearchText);
+    } else {
+        const std::vector<uint32_t> QueryTrigrams = GetTrigrams(SearchText);
+        uint8_t Shared[KeybindCount] = {};
+        for (const uint32_t Trigram : QueryTrigrams) {
+            const auto Postings = Index.Trigrams.find(Trigram);
+            if (Postings == Index.Trigrams.end())
+                continue;
+            for (const uint16_t Entry : Postings->second)
+                ++Shared[Entry];
+        }
+
+        const size_t MinimumShared = (QueryTrigrams.size() + 1) / 2;
+        for (size_t i = 0; i < KeybindCount; ++i) {
+            if (Shared[i] == 0)
+                continue;
+            Scores[i] = ScoreKeybind(Index.Names[i], Index.Texts[i], SearchText);
+            if (Scores[i] == 0 && Shared[i] >= MinimumShared)
+                Scores[i] = static_cast<int>(Shared[i] * 300 / QueryTrigrams.size());
+        }
+    }
+
+    std::vector<KeybindMatch> Matches;
+    for (size_t i = 0; i < KeybindCount; ++i) {
+        if (Scores[i] > 0)
+            Matches.push_back({Scores[i], static_cast<uint16_t>(i)});
+    }
+
+    const size_t ResultCount = std::min(MaxResults, Matches.size());
+    std::partial_sort(Matches.begin(), Matches.begin() + ResultCount, Matches.end(), [&Index](const KeybindMatch &Left, const KeybindMatch &Right) {
+        if (Left.Score != Right.Score)
+            return Left.Score > Right.Score;
+        if (Index.Names[Left.Index].size() != Index.Names[Right.Index].size())
+            return Index.Names[Left.Index].size() < Index.Names[Right.Index].size();
+        return Left.Index < Right.Index;
+    });
+
+    std::vector<const KeybindInfo *> Results;
+    Results.reserve(ResultCount);
+    for (size_t i = 0; i < ResultCount; ++i)
+        Results.push_back(&KeybindTable[Matches[i].Index]);
+    return Results;
+}
\ No newline at end of file
@@ -0,0 +1,7 @@
+#pragma once
+
+#include "keybind_table.h"
+#include <string_view>
+#include <vector>
+
+std::vector<const KeybindInfo *> SearchKeybinds(std::string_view Query, size_t MaxResults);
\ No newline at end of file
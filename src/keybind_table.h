@@ -0,0 +1,163 @@
+#pragma once
+
+#include "nexus/Nexus.h"
+#include <cstddef>
+
+enum class EKeybindCategory {
+    Movement,
+    Skills,
+    Targeting,
+    Ui,
+    Camera,
+    Screenshots,
+    Map,
+    Mounts,
+    Mastery,
+    Misc,
+    Toys,
+    BuildTemplates,
+    EquipmentTemplates,
+};
+
+struct KeybindInfo {
+    EGameBinds Bind;
+    const char *Identifier;
+    const char *Name;
+    EKeybindCategory Category;
+};
+
+inline constexpr const char *KeybindCategoryNames[] = {"Movement", "Skills", "Targeting", "UI", "Camera", "Screenshots", "Map", "Mounts", "Mastery", "Misc", "Toys/Novelties", "Build Templates", "Equipment Templates"};
+
+inline constexpr KeybindInfo KeybindTable[] = {
+    {GB_MoveDodge, "GB_MoveDodge", "Dodge", EKeybindCategory::Movement},
+    {GB_MoveJump_SwimUp_FlyUp, "GB_MoveJump_SwimUp_FlyUp", "Jump", EKeybindCategory::Movement},
+    {GB_MoveAboutFace, "GB_MoveAboutFace", "About Face", EKeybindCategory::Movement},
+    {GB_SkillWeapon1, "GB_SkillWeapon1", "Weapon 1", EKeybindCategory::Skills},
+    {GB_SkillWeapon2, "GB_SkillWeapon2", "Weapon 2", EKeybindCategory::Skills},
+    {GB_SkillWeapon3, "GB_SkillWeapon3", "Weapon 3", EKeybindCategory::Skills},
+    {GB_SkillWeapon4, "GB_SkillWeapon4", "Weapon 4", EKeybindCategory::Skills},
+    {GB_SkillWeapon5, "GB_SkillWeapon5", "Weapon 5", EKeybindCategory::Skills},
+    {GB_SkillHeal, "GB_SkillHeal", "Heal", EKeybindCategory::Skills},
+    {GB_SkillUtility1, "GB_SkillUtility1", "Utility 1", EKeybindCategory::Skills},
+    {GB_SkillUtility2, "GB_SkillUtility2", "Utility 2", EKeybindCategory::Skills},
+    {GB_SkillUtility3, "GB_SkillUtility3", "Utility 3", EKeybindCategory::Skills},
+    {GB_SkillElite, "GB_SkillElite", "Elite", EKeybindCategory::Skills},
+    {GB_SkillProfession1, "GB_SkillProfession1", "Profession 1", EKeybindCategory::Skills},
+    {GB_SkillProfession2, "GB_SkillProfession2", "Profession 2", EKeybindCategory::Skills},
+    {GB_SkillProfession3, "GB_SkillProfession3", "Profession 3", EKeybindCategory::Skills},
+    {GB_SkillProfession4, "GB_SkillProfession4", "Profession 4", EKeybindCategory::Skills},
+    {GB_SkillProfession5, "GB_SkillProfession5", "Profession 5", EKeybindCategory::Skills},
+    {GB_SkillProfession6, "GB_SkillProfession6", "Profession 6", EKeybindCategory::Skills},
+    {GB_SkillProfession7, "GB_SkillProfession7", "Profession 7", EKeybindCategory::Skills},
+    {GB_SkillWeaponSwap, "GB_SkillWeaponSwap", "Weapon Swap", EKeybindCategory::Skills},
+    {GB_SkillSpecialAction, "GB_SkillSpecialAction", "Special Action", EKeybindCategory::Skills},
+    {GB_TargetTake, "GB_TargetTake", "Take Target", EKeybindCategory::Targeting},
+    {GB_TargetCall, "GB_TargetCall", "Call Target", EKeybindCategory::Targeting},
+    {GB_TargetAlert, "GB_TargetAlert", "Alert", EKeybindCategory::Targeting},
+    {GB_TargetCallLocal, "GB_TargetCallLocal", "Call Local Target", EKeybindCategory::Targeting},
+    {GB_TargetTakeLocal, "GB_TargetTakeLocal", "Take Local Target", EKeybindCategory::Targeting},
+    {GB_TargetEnemyNearest, "GB_TargetEnemyNearest", "Nearest Enemy", EKeybindCategory::Targeting},
+    {GB_TargetEnemyNext, "GB_TargetEnemyNext", "Next Enemy", EKeybindCategory::Targeting},
+    {GB_TargetEnemyPrev, "GB_TargetEnemyPrev", "Previous Enemy", EKeybindCategory::Targeting},
+    {GB_TargetAllyNearest, "GB_TargetAllyNearest", "Nearest Ally", EKeybindCategory::Targeting},
+    {GB_TargetAllyNext, "GB_TargetAllyNext", "Next Ally", EKeybindCategory::Targeting},
+    {GB_TargetAllyPrev, "GB_TargetAllyPrev", "Previous Ally", EKeybindCategory::Targeting},
+    {GB_TargetLock, "GB_TargetLock", "Lock Target", EKeybindCategory::Targeting},
+    {GB_TargetSnapGroundTarget, "GB_TargetSnapGroundTarget", "Snap Ground Target", EKeybindCategory::Targeting},
+    {GB_TargetSnapGroundTargetToggle, "GB_TargetSnapGroundTargetToggle", "Snap Ground Target Toggle", EKeybindCategory::Targeting},
+    {GB_TargetAutoTargetingDisable, "GB_TargetAutoTargetingDisable", "Auto-Targeting Disable", EKeybindCategory::Targeting},
+    {GB_TargetAutoTargetingToggle, "GB_TargetAutoTargetingToggle", "Auto-Targeting Toggle", EKeybindCategory::Targeting},
+    {GB_TargetAllyTargetingMode, "GB_TargetAllyTargetingMode", "Ally Targeting Mode", EKeybindCategory::Targeting},
+    {GB_TargetAllyTargetingModeToggle, "GB_TargetAllyTargetingModeToggle", "Ally Targeting Mode Toggle", EKeybindCategory::Targeting},
+    {GB_UiCommerce, "GB_UiCommerce", "Trading Post", EKeybindCategory::Ui},
+    {GB_UiContacts, "GB_UiContacts", "Contacts", EKeybindCategory::Ui},
+    {GB_UiGuild, "GB_UiGuild", "Guild", EKeybindCategory::Ui},
+    {GB_UiHero, "GB_UiHero", "Hero", EKeybindCategory::Ui},
+    {GB_UiInventory, "GB_UiInventory", "Inventory", EKeybindCategory::Ui},
+    {GB_UiKennel, "GB_UiKennel", "Pets", EKeybindCategory::Ui},
+    {GB_UiLogout, "GB_UiLogout", "Logout", EKeybindCategory::Ui},
+    {GB_UiMail, "GB_UiMail", "Mail", EKeybindCategory::Ui},
+    {GB_UiOptions, "GB_UiOptions", "Options", EKeybindCategory::Ui},
+    {GB_UiParty, "GB_UiParty", "Party", EKeybindCategory::Ui},
+    {GB_UiPvp, "GB_UiPvp", "PvP", EKeybindCategory::Ui},
+    {GB_UiPvpBuild, "GB_UiPvpBuild", "PvP Build", EKeybindCategory::Ui},
+    {GB_UiScoreboard, "GB_UiScoreboard", "Scoreboard", EKeybindCategory::Ui},
+    {GB_UiSeasonalObjectivesShop, "GB_UiSeasonalObjectivesShop", "Wizard's Vault", EKeybindCategory::Ui},
+    {GB_UiInformation, "GB_UiInformation", "Information", EKeybindCategory::Ui},
+    {GB_UiChatToggle, "GB_UiChatToggle", "Chat Toggle", EKeybindCategory::Ui},
+    {GB_UiChatCommand, "GB_UiChatCommand", "Chat Command", EKeybindCategory::Ui},
+    {GB_UiChatFocus, "GB_UiChatFocus", "Chat Focus", EKeybindCategory::Ui},
+    {GB_UiChatReply, "GB_UiChatReply", "Chat Reply", EKeybindCategory::Ui},
+    {GB_UiToggle, "GB_UiToggle", "UI Toggle", EKeybindCategory::Ui},
+    {GB_UiSquadBroadcastChatToggle, "GB_UiSquadBroadcastChatToggle", "Squad Broadcast Chat Toggle", EKeybindCategory::Ui},
+    {GB_UiSquadBroadcastChatCommand, "GB_UiSquadBroadcastChatCommand", "Squad Broadcast Chat Command", EKeybindCategory::Ui},
+    {GB_UiSquadBroadcastChatFocus, "GB_UiSquadBroadcastChatFocus", "Squad Broadcast Chat Focus", EKeybindCategory::Ui},
+    {GB_CameraFree, "GB_CameraFree", "Free Camera", EKeybindCategory::Camera},
+    {GB_CameraZoomIn, "GB_CameraZoomIn", "Zoom In", EKeybindCategory::Camera},
+    {GB_CameraZoomOut, "GB_CameraZoomOut", "Zoom Out", EKeybindCategory::Camera},
+    {GB_CameraReverse, "GB_CameraReverse", "Reverse Camera", EKeybindCategory::Camera},
+    {GB_CameraActionMode, "GB_CameraActionMode", "Action Mode", EKeybindCategory::Camera},
+    {GB_CameraActionModeDisable, "GB_CameraActionModeDisable", "Action Mode Disable", EKeybindCategory::Camera},
+    {GB_ScreenshotNormal, "GB_ScreenshotNormal", "Normal Screenshot", EKeybindCategory::Screenshots},
+    {GB_ScreenshotStereoscopic, "GB_ScreenshotStereoscopic", "Stereoscopic Screenshot", EKeybindCategory::Screenshots},
+    {GB_MapToggle, "GB_MapToggle", "Toggle Map", EKeybindCategory::Map},
+    {GB_MapFocusPlayer, "GB_MapFocusPlayer", "Focus Player", EKeybindCategory::Map},
+    {GB_MapFloorDown, "GB_MapFloorDown", "Floor Down", EKeybindCategory::Map},
+    {GB_MapFloorUp, "GB_MapFloorUp", "Floor Up", EKeybindCategory::Map},
+    {GB_MapZoomIn, "GB_MapZoomIn", "Map Zoom In", EKeybindCategory::Map},
+    {GB_MapZoomOut, "GB_MapZoomOut", "Map Zoom Out", EKeybindCategory::Map},
+    {GB_SpumoniToggle, "GB_SpumoniToggle", "Mount / Dismount", EKeybindCategory::Mounts},
+    {GB_SpumoniMovement, "GB_SpumoniMovement", "Mount Ability 1", EKeybindCategory::Mounts},
+    {GB_SpumoniSecondaryMovement, "GB_SpumoniSecondaryMovement", "Mount Ability 2", EKeybindCategory::Mounts},
+    {GB_SpumoniMAM01, "GB_SpumoniMAM01", "Raptor", EKeybindCategory::Mounts},
+    {GB_SpumoniMAM02, "GB_SpumoniMAM02", "Springer", EKeybindCategory::Mounts},
+    {GB_SpumoniMAM03, "GB_SpumoniMAM03", "Skimmer", EKeybindCategory::Mounts},
+    {GB_SpumoniMAM04, "GB_SpumoniMAM04", "Jackal", EKeybindCategory::Mounts},
+    {GB_SpumoniMAM05, "GB_SpumoniMAM05", "Griffon", EKeybindCategory::Mounts},
+    {GB_SpumoniMAM06, "GB_SpumoniMAM06", "Roller Beetle", EKeybindCategory::Mounts},
+    {GB_SpumoniMAM07, "GB_SpumoniMAM07", "Warclaw", EKeybindCategory::Mounts},
+    {GB_SpumoniMAM08, "GB_SpumoniMAM08", "Skyscale", EKeybindCategory::Mounts},
+    {GB_SpumoniMAM09, "GB_SpumoniMAM09", "Siege Turtle", EKeybindCategory::Mounts},
+    {GB_MasteryAccess, "GB_MasteryAccess", "Mastery", EKeybindCategory::Mastery},
+    {GB_MasteryAccess01, "GB_MasteryAccess01", "Fishing", EKeybindCategory::Mastery},
+    {GB_MasteryAccess02, "GB_MasteryAccess02", "Skiff", EKeybindCategory::Mastery},
+    {GB_MasteryAccess03, "GB_MasteryAccess03", "Jade Bot Waypoint", EKeybindCategory::Mastery},
+    {GB_MasteryAccess04, "GB_MasteryAccess04", "Rift Scan", EKeybindCategory::Mastery},
+    {GB_MasteryAccess05, "GB_MasteryAccess05", "Skyscale", EKeybindCategory::Mastery},
+    {GB_MasteryAccess06, "GB_MasteryAccess06", "Homestead Doorway", EKeybindCategory::Mastery},
+    {GB_MiscAoELoot, "GB_MiscAoELoot", "AoE Loot", EKeybindCategory::Misc},
+    {GB_MiscInteract, "GB_MiscInteract", "Interact", EKeybindCategory::Misc},
+    {GB_MiscShowEnemies, "GB_MiscShowEnemies", "Show Enemies", EKeybindCategory::Misc},
+    {GB_MiscShowAllies, "GB_MiscShowAllies", "Show Allies", EKeybindCategory::Misc},
+    {GB_MiscCombatStance, "GB_MiscCombatStance", "Stow / Draw Weapons", EKeybindCategory::Misc},
+    {GB_MiscToggleLanguage, "GB_MiscToggleLanguage", "Toggle Language", EKeybindCategory::Misc},
+    {GB_MiscTogglePetCombat, "GB_MiscTogglePetCombat", "Toggle Pet Combat", EKeybindCategory::Misc},
+    {GB_MiscToggleFullScreen, "GB_MiscToggleFullScreen", "Toggle Fullscreen", EKeybindCategory::Misc},
+    {GB_MiscToggleDecorationMode, "GB_MiscToggleDecorationMode", "Toggle Decorate Mode", EKeybindCategory::Misc},
+    {GB_ToyUseDefault, "GB_ToyUseDefault", "Default Novelty", EKeybindCategory::Toys},
+    {GB_ToyUseSlot1, "GB_ToyUseSlot1", "Chair", EKeybindCategory::Toys},
+    {GB_ToyUseSlot2, "GB_ToyUseSlot2", "Instrument", EKeybindCategory::Toys},
+    {GB_ToyUseSlot3, "GB_ToyUseSlot3", "Held Item", EKeybindCategory::Toys},
+    {GB_ToyUseSlot4, "GB_ToyUseSlot4", "Toy", EKeybindCategory::Toys},
+    {GB_ToyUseSlot5, "GB_ToyUseSlot5", "Tonic", EKeybindCategory::Toys},
+    {GB_Loadout1, "GB_Loadout1", "Build Template 1", EKeybindCategory::BuildTemplates},
+    {GB_Loadout2, "GB_Loadout2", "Build Template 2", EKeybindCategory::BuildTemplates},
+    {GB_Loadout3, "GB_Loadout3", "Build Template 3", EKeybindCategory::BuildTemplates},
+    {GB_Loadout4, "GB_Loadout4", "Build Template 4", EKeybindCategory::BuildTemplates},
+    {GB_Loadout5, "GB_Loadout5", "Build Template 5", EKeybindCategory::BuildTemplates},
+    {GB_Loadout6, "GB_Loadout6", "Build Template 6", EKeybindCategory::BuildTemplates},
+    {GB_Loadout7, "GB_Loadout7", "Build Template 7", EKeybindCategory::BuildTemplates},
+    {GB_Loadout8, "GB_Loadout8", "Build Template 8", EKeybindCategory::BuildTemplates},
+    {GB_Loadout9, "GB_Loadout9", "Build Template 9", EKeybindCategory::BuildTemplates},
+    {GB_GearLoadout1, "GB_GearLoadout1", "Equipment Template 1", EKeybindCategory::EquipmentTemplates},
+    {GB_GearLoadout2, "GB_GearLoadout2", "Equipment Template 2", EKeybindCategory::EquipmentTemplates},
+    {GB_GearLoadout3, "GB_GearLoadout3", "Equipment Template 3", EKeybindCategory::EquipmentTemplates},
+    {GB_GearLoadout4, "GB_GearLoadout4", "Equipment Template 4", EKeybindCategory::EquipmentTemplates},
+    {GB_GearLoadout5, "GB_GearLoadout5", "Equipment Template 5", EKeybindCategory::EquipmentTemplates},
+    {GB_GearLoadout6, "GB_GearLoadout6", "Equipment Template 6", EKeybindCategory::EquipmentTemplates},
+    {GB_GearLoadout7, "GB_GearLoadout7", "Equipment Template 7", EKeybindCategory::EquipmentTemplates},
+    {GB_GearLoadout8, "GB_GearLoadout8", "Equipment Template 8", EKeybindCategory::EquipmentTemplates},
+    {GB_GearLoadout9, "GB_GearLoadout9", "Equipment Template 9", EKeybindCategory::EquipmentTemplates},
+};
+
+inline constexpr size_t KeybindCount = sizeof(KeybindTable) / sizeof(KeybindTable[0]);
\ No newline at end of file
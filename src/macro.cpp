@@ -1,17 +1,81 @@
 #include "macro.h"
+#include "action_sequence_store.h"
+#include "macro_sax.h"
 #include "string_conversions.h"
+#include <cctype>
+#include <fstream>
+#include <mutex>
 #include <stdexcept>
 
-nlohmann::json MacroToJson(const Macro &Macro, const int Slot) {
-    nlohmann::json MacroObject;
-    const std::string Identifier = "MACRO_" + std::to_string(Slot + 1);
+static std::mutex MacroBodyMutex;
 
-    MacroObject["name"] = Macro.Name;
-    MacroObject["identifier"] = Identifier;
-    MacroObject["enabled"] = Macro.Enabled;
+std::shared_ptr<const ActionSequence> GetMacroActions(const Macro &Macro) {
+    if (auto Actions = std::atomic_load(&Macro.Actions))
+        return Actions;
+
+    std::lock_guard<std::mutex> Lock(MacroBodyMutex);
+    if (auto Actions = std::atomic_load(&Macro.Actions))
+        return Actions;
+
+    if (Macro.Storage.SequenceHash != 0) {
+        if (auto Actions = FindActionSequence(Macro.Storage.SequenceHash)) {
+            std::atomic_store(&Macro.Actions, Actions);
+            return Actions;
+        }
+    }
+
+    try {
+        std::ifstream BodyFile(Macro.Storage.BodyPath, std::ios::binary);
+        if (!BodyFile.is_open())
+            return std::make_shared<const ActionSequence>();
+
+        BodyFile.seekg(static_cast<std::streamoff>(Macro.Storage.Offset));
+        auto Actions = InternActionSequence(ParseMacroActionsJson(BodyFile));
+        std::atomic_store(&Macro.Actions, Actions);
+        return Actions;
+    } catch (const std::exception &) {
+        return std::make_shared<const ActionSequence>();
+    }
+}
+
+void SetMacroActions(Macro &Macro, ActionSequence Actions) {
+    Macro.ActionCount = Actions.size();
+    std::atomic_store(&Macro.Actions, InternActionSequence(std::move(Actions)));
+}
+
+void SetMacroStorage(Macro &Macro, const MacroStorage &Storage) {
+    std::lock_guard<std::mutex> Lock(MacroBodyMutex);
+    Macro.Storage = Storage;
+}
+
+void ReplaceMacro(Macro &Target, Macro Source) {
+    Target.Name = std::move(Source.Name);
+    Target.Identifier = std::move(Source.Identifier);
+    Target.Profile = std::move(Source.Profile);
+    Target.Enabled = Source.Enabled;
+    Target.ActionCount = Source.ActionCount;
 
+    std::lock_guard<std::mutex> Lock(MacroBodyMutex);
+    Target.Storage = std::move(Source.Storage);
+    std::atomic_store(&Target.Actions, std::atomic_load(&Source.Actions));
+}
+
+bool IsMacroBodyLoaded(const Macro &Macro) { return std::atomic_load(&Macro.Actions) != nullptr; }
+
+bool IsValidMacroIdentifier(const std::string &Identifier) {
+    if (Identifier.empty() || Identifier.length() > 64)
+        return false;
+    for (const char Character : Identifier) {
+        if (!std::isalnum(static_cast<unsigned char>(Character)) && Character != '_' && Character != '-')
+            return false;
+    }
+    return true;
+}
+
+nlohmann::json ActionsToJson(const ActionSequence &Actions) {
     nlohmann::json ActionsArray = nlohmann::json::array();
-    for (const auto &Action : Macro.Actions) {
+    ActionsArray.get_ref<nlohmann::json::array_t &>().reserve(Actions.size());
+    for (const auto &Action : Actions) {
         nlohmann::json ActionObject;
 
         if (Action.MacroInputType == EMacroInputType::GameBind) {
@@ -27,24 +91,48 @@ nlohmann::json MacroToJson(const Macro &Macro, const int Slot) {
             if (Action.MoveBeforeMouseClick) {
                 ActionObject["mouseX"] = Action.MousePosition.x;
                 ActionObject["mouseY"] = Action.MousePosition.y;
-                ActionObject["poGameBindsitionType"] = MousePositionTypeToString(Action.MousePosition.MousePositionType);
+                ActionObject["positionType"] = MousePositionTypeToString(Action.MousePosition.MousePositionType);
             }
         } else if (Action.MacroInputType == EMacroInputType::MouseMove) {
             ActionObject["inputType"] = "MouseMove";
             ActionObject["mouseX"] = Action.MousePosition.x;
             ActionObject["mouseY"] = Action.MousePosition.y;
             ActionObject["positionType"] = MousePositionTypeToString(Action.MousePosition.MousePositionType);
+        } else if (Action.MacroInputType == EMacroInputType::WaitCondition) {
+            ActionObject["inputType"] = "WaitCondition";
+            ActionObject["condition"] = WaitConditionToString(Action.WaitCondition);
+            ActionObject["timeoutMs"] = Action.TimeoutMilliseconds;
         }
 
         ActionObject["delayMs"] = Action.DelayMilliseconds;
-        ActionsArray.push_back(ActionObject);
+        ActionsArray.push_back(std::move(ActionObject));
     }
 
-    MacroObject["actions"] = ActionsArray;
+    return ActionsArray;
+}
+
+nlohmann::json MacroToJson(const Macro &Macro) {
+    nlohmann::json MacroObject;
+
+    MacroObject["name"] = Macro.Name;
+    MacroObject["identifier"] = Macro.Identifier;
+    if (!Macro.Profile.empty())
+        MacroObject["profile"] = Macro.Profile;
+    MacroObject["enabled"] = Macro.Enabled;
+    MacroObject["actions"] = ActionsToJson(*GetMacroActions(Macro));
     return MacroObject;
 }
 
-Macro JsonToMacro(const nlohmann::json &Json, const int Slot) {
+static int JsonToInt(const nlohmann::json &Object, const char *Key, const int Default = 0) {
+    const auto Value = Object.find(Key);
+    if (Value == Object.end())
+        return Default;
+    if (!Value->is_number())
+        throw std::invalid_argument("Expected a number in macro JSON");
+    return Value->get<int>();
+}
+
+Macro JsonToMacro(const nlohmann::json &Json) {
     if (!Json.is_object() || !Json.contains("name") || !Json.contains("actions"))
         throw std::invalid_argument("Invalid macro JSON");
 
@@ -55,51 +143,62 @@ Macro JsonToMacro(const nlohmann::json &Json, const int Slot) {
     if (!Json["actions"].is_array())
         throw std::invalid_argument("Actions must be an array");
 
-    Macro NewMacro(Name, "MACRO_" + std::to_string(Slot + 1));
+    Macro NewMacro(Name, Json.value("identifier", std::string()));
+    if (!NewMacro.Identifier.empty() && !IsValidMacroIdentifier(NewMacro.Identifier))
+        throw std::invalid_argument("Invalid macro identifier");
+    NewMacro.Profile = Json.value("profile", std::string());
     NewMacro.Enabled = Json.value("enabled", false);
 
+    ActionSequence Actions;
+
     for (const auto &ActionObject : Json["actions"]) {
         if (!ActionObject.is_object() || !ActionObject.contains("inputType"))
             throw std::invalid_argument("Invalid action in macro");
 
-        std::string InputTypeString = ActionObject["inputType"];
-        int DelayMilliseconds = ActionObject.value("delayMs", 0);
+        const std::string &InputTypeString = ActionObject["inputType"].get_ref<const std::string &>();
+        const int DelayMilliseconds = JsonToInt(ActionObject, "delayMs");
 
         if (InputTypeString == "GameBind") {
             if (!ActionObject.contains("gameBind") || !ActionObject.contains("isKeyDown"))
                 throw std::invalid_argument("GameBind action missing required fields");
-            EGameBinds GameBind = StringToIngameKeybind(ActionObject["gameBind"].get<std::string>());
+            EGameBinds GameBind = StringToIngameKeybind(ActionObject["gameBind"].get_ref<const std::string &>());
             bool IsKeybindDown = ActionObject["isKeyDown"].get<bool>();
-            NewMacro.Actions.emplace_back(GameBind, IsKeybindDown, DelayMilliseconds);
+            Actions.emplace_back(GameBind, IsKeybindDown, DelayMilliseconds);
         } else if (InputTypeString == "MouseButton") {
             if (!ActionObject.contains("mouseButton") || !ActionObject.contains("isKeyDown"))
                 throw std::invalid_argument("MouseButton action missing required fields");
-            EMouseButton MouseButton = StringToMouseButton(ActionObject["mouseButton"].get<std::string>());
+            EMouseButton MouseButton = StringToMouseButton(ActionObject["mouseButton"].get_ref<const std::string &>());
             bool IsKeybindDown = ActionObject["isKeyDown"].get<bool>();
 
             if (const bool MoveBeforeClick = ActionObject.value("moveBeforeClick", false); MoveBeforeClick && ActionObject.contains("mouseX") && ActionObject.contains("mouseY")) {
-                const int MouseX = ActionObject["mouseX"];
-                const int MouseY = ActionObject["mouseY"];
+                const int MouseX = JsonToInt(ActionObject, "mouseX");
+                const int MouseY = JsonToInt(ActionObject, "mouseY");
                 std::string PositionTypeString = ActionObject.value("positionType", "Absolute");
                 const EMousePositionType PositionType = StringToMousePositionType(PositionTypeString);
                 EMousePosition Position(MouseX, MouseY, PositionType);
-                NewMacro.Actions.emplace_back(MouseButton, IsKeybindDown, Position, DelayMilliseconds);
+                Actions.emplace_back(MouseButton, IsKeybindDown, Position, DelayMilliseconds);
             } else {
-                NewMacro.Actions.emplace_back(MouseButton, IsKeybindDown, DelayMilliseconds);
+                Actions.emplace_back(MouseButton, IsKeybindDown, DelayMilliseconds);
             }
         } else if (InputTypeString == "MouseMove") {
             if (!ActionObject.contains("mouseX") || !ActionObject.contains("mouseY"))
                 throw std::invalid_argument("MouseMove action missing coordinates");
-            const int MouseX = ActionObject["mouseX"];
-            const int MouseY = ActionObject["mouseY"];
+            const int MouseX = JsonToInt(ActionObject, "mouseX");
+            const int MouseY = JsonToInt(ActionObject, "mouseY");
             std::string PositionTypeString = ActionObject.value("positionType", "Absolute");
             const EMousePositionType PositionType = StringToMousePositionType(PositionTypeString);
             EMousePosition Position(MouseX, MouseY, PositionType);
-            NewMacro.Actions.emplace_back(Position, DelayMilliseconds);
+            Actions.emplace_back(Position, DelayMilliseconds);
+        } else if (InputTypeString == "WaitCondition") {
+            if (!ActionObject.contains("condition"))
+                throw std::invalid_argument("WaitCondition action missing condition");
+            const EWaitCondition WaitCondition = StringToWaitCondition(ActionObject["condition"].get_ref<const std::string &>());
+            Actions.emplace_back(WaitCondition, JsonToInt(ActionObject, "timeoutMs"), DelayMilliseconds);
         } else {
             throw std::invalid_argument("Unknown input type in macro");
         }
     }
 
+    SetMacroActions(NewMacro, std::move(Actions));
     return NewMacro;
 }
\ No newline at end of file
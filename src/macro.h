@@ -2,13 +2,24 @@
 
 #include "nexus/Nexus.h"
 #include "nlohmann/json.hpp"
+#include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
 enum class EMacroInputType {
     GameBind,
     MouseButton,
-    MouseMove
+    MouseMove,
+    WaitCondition
+};
+
+enum class EWaitCondition {
+    OutOfCombat,
+    InCombat,
+    Mounted,
+    Unmounted,
+    MapChanged
 };
 
 enum class EMouseButton {
@@ -42,25 +53,58 @@ struct KeybindAction {
     bool IsKeybindDown;
     bool MoveBeforeMouseClick;
     int DelayMilliseconds;
+    EWaitCondition WaitCondition;
+    int TimeoutMilliseconds;
 
-    KeybindAction(const EGameBinds bind, const bool down, const int delay = 0) : MacroInputType(EMacroInputType::GameBind), GameBind(bind), MouseButton(EMouseButton::Left), IsKeybindDown(down), MoveBeforeMouseClick(false), DelayMilliseconds(delay) {}
+    KeybindAction(const EGameBinds bind, const bool down, const int delay = 0) : MacroInputType(EMacroInputType::GameBind), GameBind(bind), MouseButton(EMouseButton::Left), IsKeybindDown(down), MoveBeforeMouseClick(false), DelayMilliseconds(delay), WaitCondition(EWaitCondition::OutOfCombat), TimeoutMilliseconds(0) {}
 
-    KeybindAction(const EMouseButton button, const bool down, const int delay = 0) : MacroInputType(EMacroInputType::MouseButton), GameBind(GB_SkillWeapon1), MouseButton(button), IsKeybindDown(down), MoveBeforeMouseClick(false), DelayMilliseconds(delay) {}
+    KeybindAction(const EMouseButton button, const bool down, const int delay = 0) : MacroInputType(EMacroInputType::MouseButton), GameBind(GB_SkillWeapon1), MouseButton(button), IsKeybindDown(down), MoveBeforeMouseClick(false), DelayMilliseconds(delay), WaitCondition(EWaitCondition::OutOfCombat), TimeoutMilliseconds(0) {}
 
-    KeybindAction(const EMouseButton button, const bool down, const EMousePosition pos, const int delay = 0) : MacroInputType(EMacroInputType::MouseButton), GameBind(GB_SkillWeapon1), MouseButton(button), MousePosition(pos), IsKeybindDown(down), MoveBeforeMouseClick(true), DelayMilliseconds(delay) {}
+    KeybindAction(const EMouseButton button, const bool down, const EMousePosition pos, const int delay = 0) : MacroInputType(EMacroInputType::MouseButton), GameBind(GB_SkillWeapon1), MouseButton(button), MousePosition(pos), IsKeybindDown(down), MoveBeforeMouseClick(true), DelayMilliseconds(delay), WaitCondition(EWaitCondition::OutOfCombat), TimeoutMilliseconds(0) {}
 
-    explicit KeybindAction(const EMousePosition pos, const int delay = 0) : MacroInputType(EMacroInputType::MouseMove), GameBind(GB_SkillWeapon1), MouseButton(EMouseButton::Left), MousePosition(pos), IsKeybindDown(false), MoveBeforeMouseClick(false), DelayMilliseconds(delay) {}
+    KeybindAction(const EWaitCondition condition, const int timeout, const int delay = 0) : MacroInputType(EMacroInputType::WaitCondition), GameBind(GB_SkillWeapon1), MouseButton(EMouseButton::Left), IsKeybindDown(false), MoveBeforeMouseClick(false), DelayMilliseconds(delay), WaitCondition(condition), TimeoutMilliseconds(timeout) {}
+
+    explicit KeybindAction(const EMousePosition pos, const int delay = 0) : MacroInputType(EMacroInputType::MouseMove), GameBind(GB_SkillWeapon1), MouseButton(EMouseButton::Left), MousePosition(pos), IsKeybindDown(false), MoveBeforeMouseClick(false), DelayMilliseconds(delay), WaitCondition(EWaitCondition::OutOfCombat), TimeoutMilliseconds(0) {}
+};
+
+using ActionSequence = std::vector<KeybindAction>;
+
+struct MacroStorage {
+    std::string Path;
+    std::string BodyPath;
+    uint64_t Offset = 0;
+    uint64_t FileSize = 0;
+    int64_t FileTime = 0;
+    uint64_t ContentHash = 0;
+    uint64_t SequenceHash = 0;
 };
 
 struct Macro {
     std::string Name;
     std::string Identifier;
+    std::string Profile;
     bool Enabled;
-    std::vector<KeybindAction> Actions;
+    size_t ActionCount;
+    MacroStorage Storage;
+    mutable std::shared_ptr<const ActionSequence> Actions;
 
-    Macro(std::string n, std::string id) : Name(std::move(n)), Identifier(std::move(id)), Enabled(true) {}
+    Macro(std::string n, std::string id) : Name(std::move(n)), Identifier(std::move(id)), Enabled(true), ActionCount(0), Actions(std::make_shared<const ActionSequence>()) {}
 };
 
-nlohmann::json MacroToJson(const Macro &Macro, int Slot);
+std::shared_ptr<const ActionSequence> GetMacroActions(const Macro &Macro);
+
+void SetMacroActions(Macro &Macro, ActionSequence Actions);
+
+void SetMacroStorage(Macro &Macro, const MacroStorage &Storage);
+
+void ReplaceMacro(Macro &Target, Macro Source);
+
+bool IsMacroBodyLoaded(const Macro &Macro);
+
+bool IsValidMacroIdentifier(const std::string &Identifier);
+
+nlohmann::json ActionsToJson(const ActionSequence &Actions);
+
+nlohmann::json MacroToJson(const Macro &Macro);
 
-Macro JsonToMacro(const nlohmann::json &Json, int Slot);
+Macro JsonToMacro(const nlohmann::json &Json);
\ No newline at end of file
@@ -1,8 +1,13 @@
 #include "macro_executor.h"
 #include "game_mode_check.h"
+#include "game_state.h"
+#include "keybind_table.h"
 #include "macro.h"
+#include "macro_profiler.h"
+#include "macro_timeline.h"
 #include "shared.h"
 #include "string_conversions.h"
+#include <algorithm>
 #include <mutex>
 #include <thread>
 #include <windows.h>
@@ -53,10 +58,91 @@ void SendMouseClickAtPosition(const EMouseButton MouseButton, const bool MouseBu
     SendMouseInput(MouseButton, MouseButtonIsDown);
 }
 
+static void ReleaseHeldInputs(std::vector<EGameBinds> &HeldBinds, uint32_t &HeldMouseButtons) {
+    for (const EGameBinds Bind : HeldBinds)
+        ApiDefinition->GameBinds_ReleaseAsync(Bind);
+    HeldBinds.clear();
+
+    for (int Button = 0; HeldMouseButtons != 0; ++Button, HeldMouseButtons >>= 1) {
+        if (HeldMouseButtons & 1)
+            SendMouseInput(static_cast<EMouseButton>(Button), false);
+    }
+}
+
+static bool AbortIfDisallowed(const Macro &Macro, uint32_t &SeenModeChanges, std::vector<EGameBinds> &HeldBinds, uint32_t &HeldMouseButtons) {
+    const uint32_t ModeChanges = GetGameStateEventCount(EGameStateEvent::CompetitiveChanged);
+    if (ModeChanges == SeenModeChanges)
+        return false;
+    SeenModeChanges = ModeChanges;
+    if (AreMacrosAllowed())
+        return false;
+
+    ReleaseHeldInputs(HeldBinds, HeldMouseButtons);
+    ApiDefinition->Log(LOGL_INFO, "MacroManager", ("Macro aborted, entered a competitive game mode: " + Macro.Name).c_str());
+    ApiDefinition->GUI_SendAlert("Macro stopped: PVP/WvW mode entered");
+    return true;
+}
+
+static bool IsWaitConditionMet(const EWaitCondition WaitCondition, const GameState &State, const uint32_t StartMapChanges) {
+    switch (WaitCondition) {
+    case EWaitCondition::OutOfCombat:
+        return !State.IsInCombat;
+    case EWaitCondition::InCombat:
+        return State.IsInCombat;
+    case EWaitCondition::Mounted:
+        return State.Mount != Mumble::EMountIndex::None;
+    case EWaitCondition::Unmounted:
+        return State.Mount == Mumble::EMountIndex::None;
+    case EWaitCondition::MapChanged:
+        return GetGameStateEventCount(EGameStateEvent::MapChanged) != StartMapChanges;
+    default:
+        return true;
+    }
+}
+
+static bool WaitForCondition(const Macro &Macro, const KeybindAction &Action, uint32_t &SeenModeChanges, std::vector<EGameBinds> &HeldBinds, uint32_t &HeldMouseButtons) {
+    const auto Start = std::chrono::steady_clock::now();
+    const uint32_t StartMapChanges = GetGameStateEventCount(EGameStateEvent::MapChanged);
+    GameState State = GetGameState();
+    if (IsWaitConditionMet(Action.WaitCondition, State, StartMapChanges))
+        return true;
+
+    while (true) {
+        if (KillMacros.load()) {
+            ApiDefinition->Log(LOGL_INFO, "MacroManager", "Macro execution stopped while waiting");
+            KillMacros.store(false);
+            return false;
+        }
+
+        if (AbortIfDisallowed(Macro, SeenModeChanges, HeldBinds, HeldMouseButtons))
+            return false;
+
+        auto MaxWait = std::chrono::milliseconds(50);
+        if (Action.TimeoutMilliseconds > 0) {
+            const auto Remaining = std::chrono::milliseconds(Action.TimeoutMilliseconds) - std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - Start);
+            if (Remaining.count() <= 0) {
+                ReleaseHeldInputs(HeldBinds, HeldMouseButtons);
+                ApiDefinition->Log(LOGL_INFO, "MacroManager", ("Macro stopped, wait for " + std::string(GetWaitConditionName(Action.WaitCondition)) + " timed out: " + Macro.Name).c_str());
+                return false;
+            }
+            MaxWait = std::min(MaxWait, Remaining);
+        }
+
+        if (WaitForGameStateTick(State.UITick, MaxWait) == State.UITick)
+            continue;
+
+        State = GetGameState();
+        if (IsWaitConditionMet(Action.WaitCondition, State, StartMapChanges))
+            return true;
+    }
+}
+
 void ExecuteMacro(const Macro &Macro) {
+    MACRO_PROFILE_SCOPE(EProfileScope::ExecuteMacro);
     if (!Macro.Enabled)
         return;
 
+    uint32_t SeenModeChanges = GetGameStateEventCount(EGameStateEvent::CompetitiveChanged);
     if (!AreMacrosAllowed()) {
         ApiDefinition->GUI_SendAlert("Macros disabled in PVP/WvW modes");
         return;
@@ -64,7 +150,18 @@ void ExecuteMacro(const Macro &Macro) {
 
     ApiDefinition->Log(LOGL_INFO, "MacroManager", ("Executing macro: " + Macro.Name).c_str());
 
-    for (const auto &Action : Macro.Actions) {
+    const std::shared_ptr<const ActionSequence> Actions = GetMacroActions(Macro);
+    std::vector<EGameBinds> HeldBinds;
+    uint32_t HeldMouseButtons = 0;
+    const uint32_t TimelineRun = BeginMacroTimelineRun();
+    auto ScheduledTime = std::chrono::steady_clock::now();
+    for (uint32_t ActionIndex = 0; ActionIndex < Actions->size(); ++ActionIndex) {
+        const KeybindAction &Action = (*Actions)[ActionIndex];
+        ScheduledTime += std::chrono::milliseconds(Action.DelayMilliseconds);
+
+        if (AbortIfDisallowed(Macro, SeenModeChanges, HeldBinds, HeldMouseButtons))
+            return;
+
         if (KillMacros.load()) {
             ApiDefinition->Log(LOGL_INFO, "MacroManager", "Macro execution stopped by Kill All");
             KillMacros.store(false);
@@ -74,7 +171,7 @@ void ExecuteMacro(const Macro &Macro) {
         if (Action.DelayMilliseconds > 0) {
             int RemainingDelay = Action.DelayMilliseconds;
 
-            while (RemainingDelay > 0 && !KillMacros.load()) {
+            while (RemainingDelay > 0 && !KillMacros.load() && GetGameStateEventCount(EGameStateEvent::CompetitiveChanged) == SeenModeChanges) {
                 constexpr int ChunkSize = 50;
                 int CurrentChink = (RemainingDelay > ChunkSize) ? ChunkSize : RemainingDelay;
                 std::this_thread::sleep_for(std::chrono::milliseconds(CurrentChink));
@@ -86,29 +183,51 @@ void ExecuteMacro(const Macro &Macro) {
                 KillMacros.store(false);
                 return;
             }
+
+            if (AbortIfDisallowed(Macro, SeenModeChanges, HeldBinds, HeldMouseButtons))
+                return;
         }
 
         if (Action.MacroInputType == EMacroInputType::GameBind) {
-            if (Action.IsKeybindDown)
+            if (Action.IsKeybindDown) {
                 ApiDefinition->GameBinds_PressAsync(Action.GameBind);
-            else
+                if (std::find(HeldBinds.begin(), HeldBinds.end(), Action.GameBind) == HeldBinds.end())
+                    HeldBinds.push_back(Action.GameBind);
+            } else {
                 ApiDefinition->GameBinds_ReleaseAsync(Action.GameBind);
+                HeldBinds.erase(std::remove(HeldBinds.begin(), HeldBinds.end(), Action.GameBind), HeldBinds.end());
+            }
 
+            RecordMacroTimelineAction(TimelineRun, ActionIndex, Action, ScheduledTime);
             ApiDefinition->Log(LOGL_DEBUG, "MacroManager", ("Action executed: " + std::string(Action.IsKeybindDown ? "PRESS " : "RELEASE ") + GetKeybindName(Action.GameBind)).c_str());
         } else if (Action.MacroInputType == EMacroInputType::MouseButton) {
+            const uint32_t ButtonBit = 1u << static_cast<int>(Action.MouseButton);
+            HeldMouseButtons = Action.IsKeybindDown ? HeldMouseButtons | ButtonBit : HeldMouseButtons & ~ButtonBit;
+
             if (Action.MoveBeforeMouseClick) {
                 SendMouseClickAtPosition(Action.MouseButton, Action.IsKeybindDown, Action.MousePosition);
 
+                RecordMacroTimelineAction(TimelineRun, ActionIndex, Action, ScheduledTime);
                 ApiDefinition->Log(LOGL_DEBUG, "MacroManager", ("Mouse action at (" + std::to_string(Action.MousePosition.x) + ", " + std::to_string(Action.MousePosition.y) + "): " + std::string(Action.IsKeybindDown ? "PRESS " : "RELEASE ") + GetMouseButtonName(Action.MouseButton)).c_str());
             } else {
                 SendMouseInput(Action.MouseButton, Action.IsKeybindDown);
 
+                RecordMacroTimelineAction(TimelineRun, ActionIndex, Action, ScheduledTime);
                 ApiDefinition->Log(LOGL_DEBUG, "MacroManager", ("Mouse action executed: " + std::string(Action.IsKeybindDown ? "PRESS " : "RELEASE ") + GetMouseButtonName(Action.MouseButton)).c_str());
             }
         } else if (Action.MacroInputType == EMacroInputType::MouseMove) {
             MoveMouse(Action.MousePosition);
 
+            RecordMacroTimelineAction(TimelineRun, ActionIndex, Action, ScheduledTime);
             ApiDefinition->Log(LOGL_DEBUG, "MacroManager", ("Mouse moved to (" + std::to_string(Action.MousePosition.x) + ", " + std::to_string(Action.MousePosition.y) + ") " + (Action.MousePosition.MousePositionType == EMousePositionType::Absolute ? "[Absolute]" : "[Relative]")).c_str());
+        } else if (Action.MacroInputType == EMacroInputType::WaitCondition) {
+            if (!WaitForCondition(Macro, Action, SeenModeChanges, HeldBinds, HeldMouseButtons))
+                return;
+
+            RecordMacroTimelineAction(TimelineRun, ActionIndex, Action, ScheduledTime);
+            ScheduledTime = std::chrono::steady_clock::now();
+
+            ApiDefinition->Log(LOGL_DEBUG, "MacroManager", ("Wait satisfied: " + std::string(GetWaitConditionName(Action.WaitCondition))).c_str());
         }
     }
 
@@ -132,144 +251,14 @@ void ReleaseAllGameKeys() {
     if (!ApiDefinition)
         return;
 
-    EGameBinds allBinds[] = {
-        GB_SkillWeapon1,
-        GB_SkillWeapon2,
-        GB_SkillWeapon3,
-        GB_SkillWeapon4,
-        GB_SkillWeapon5,
-        GB_SkillHeal,
-        GB_SkillUtility1,
-        GB_SkillUtility2,
-        GB_SkillUtility3,
-        GB_SkillElite,
-        GB_MoveDodge,
-        GB_MoveJump_SwimUp_FlyUp,
-        GB_MoveAboutFace,
-        GB_MiscInteract,
-        GB_SkillWeaponSwap,
-        GB_SkillSpecialAction,
-        GB_MoveForward,
-        GB_MoveBackward,
-        GB_MoveLeft,
-        GB_MoveRight,
-        GB_SkillProfession1,
-        GB_SkillProfession2,
-        GB_SkillProfession3,
-        GB_SkillProfession4,
-        GB_SkillProfession5,
-        GB_SkillProfession6,
-        GB_SkillProfession7,
-        GB_TargetTake,
-        GB_TargetCall,
-        GB_TargetAlert,
-        GB_TargetCallLocal,
-        GB_TargetTakeLocal,
-        GB_TargetEnemyNearest,
-        GB_TargetEnemyNext,
-        GB_TargetEnemyPrev,
-        GB_TargetAllyNearest,
-        GB_TargetAllyNext,
-        GB_TargetAllyPrev,
-        GB_TargetLock,
-        GB_TargetSnapGroundTarget,
-        GB_TargetSnapGroundTargetToggle,
-        GB_TargetAutoTargetingDisable,
-        GB_TargetAutoTargetingToggle,
-        GB_TargetAllyTargetingMode,
-        GB_TargetAllyTargetingModeToggle,
-        GB_UiCommerce,
-        GB_UiContacts,
-        GB_UiGuild,
-        GB_UiHero,
-        GB_UiInventory,
-        GB_UiKennel,
-        GB_UiLogout,
-        GB_UiMail,
-        GB_UiOptions,
-        GB_UiParty,
-        GB_UiPvp,
-        GB_UiPvpBuild,
-        GB_UiScoreboard,
-        GB_UiSeasonalObjectivesShop,
-        GB_UiInformation,
-        GB_UiChatToggle,
-        GB_UiChatCommand,
-        GB_UiChatFocus,
-        GB_UiChatReply,
-        GB_UiToggle,
-        GB_UiSquadBroadcastChatToggle,
-        GB_UiSquadBroadcastChatCommand,
-        GB_UiSquadBroadcastChatFocus,
-        GB_CameraFree,
-        GB_CameraZoomIn,
-        GB_CameraZoomOut,
-        GB_CameraReverse,
-        GB_CameraActionMode,
-        GB_CameraActionModeDisable,
-        GB_ScreenshotNormal,
-        GB_ScreenshotStereoscopic,
-        GB_MapToggle,
-        GB_MapFocusPlayer,
-        GB_MapFloorDown,
-        GB_MapFloorUp,
-        GB_MapZoomIn,
-        GB_MapZoomOut,
-        GB_SpumoniToggle,
-        GB_SpumoniMovement,
-        GB_SpumoniSecondaryMovement,
-        GB_SpumoniMAM01,
-        GB_SpumoniMAM02,
-        GB_SpumoniMAM03,
-        GB_SpumoniMAM04,
-        GB_SpumoniMAM05,
-        GB_SpumoniMAM06,
-        GB_SpumoniMAM07,
-        GB_SpumoniMAM08,
-        GB_SpumoniMAM09,
-        GB_MasteryAccess,
-        GB_MasteryAccess01,
-        GB_MasteryAccess02,
-        GB_MasteryAccess03,
-        GB_MasteryAccess04,
-        GB_MasteryAccess05,
-        GB_MasteryAccess06,
-        GB_MiscAoELoot,
-        GB_MiscShowEnemies,
-        GB_MiscShowAllies,
-        GB_MiscCombatStance,
-        GB_MiscToggleLanguage,
-        GB_MiscTogglePetCombat,
-        GB_MiscToggleFullScreen,
-        GB_MiscToggleDecorationMode,
-        GB_ToyUseDefault,
-        GB_ToyUseSlot1,
-        GB_ToyUseSlot2,
-        GB_ToyUseSlot3,
-        GB_ToyUseSlot4,
-        GB_ToyUseSlot5,
-        GB_Loadout1,
-        GB_Loadout2,
-        GB_Loadout3,
-        GB_Loadout4,
-        GB_Loadout5,
-        GB_Loadout6,
-        GB_Loadout7,
-        GB_Loadout8,
-        GB_Loadout9,
-        GB_GearLoadout1,
-        GB_GearLoadout2,
-        GB_GearLoadout3,
-        GB_GearLoadout4,
-        GB_GearLoadout5,
-        GB_GearLoadout6,
-        GB_GearLoadout7,
-        GB_GearLoadout8,
-        GB_GearLoadout9};
+    constexpr EGameBinds MovementBinds[] = {GB_MoveForward, GB_MoveBackward, GB_MoveLeft, GB_MoveRight};
 
     ApiDefinition->Log(LOGL_DEBUG, "MacroManager", "Releasing all game keys...");
 
-    for (const EGameBinds bind : allBinds) {
+    for (const auto &Keybind : KeybindTable) {
+        ApiDefinition->GameBinds_ReleaseAsync(Keybind.Bind);
+    }
+    for (const EGameBinds bind : MovementBinds) {
         ApiDefinition->GameBinds_ReleaseAsync(bind);
     }
 
@@ -0,0 +1,127 @@
+#include "macro_hot_reload.h"
+#include "file_watcher.h"
+#include "keybind_manager.h"
+#include "macro_journal.h"
+#include "macro_profile.h"
+#include "macro_save.h"
+#include "shared.h"
+#include <filesystem>
+#include <unordered_set>
+
+static std::unique_ptr<FileWatcher> MacroFileWatcher;
+static std::unique_ptr<FileWatcher> SequenceFileWatcher;
+static std::string WatchedDirectory;
+static std::unordered_set<std::string> PendingMacroFiles;
+
+static std::vector<std::string> ListWatchedFiles() {
+    std::unordered_set<std::string> FileNames;
+    std::error_code Error;
+    for (const auto &DirectoryEntry : std::filesystem::directory_iterator(WatchedDirectory, Error))
+        FileNames.insert(DirectoryEntry.path().filename().string());
+    for (const auto &Macro : Macros) {
+        if (!Macro.Storage.Path.empty())
+            FileNames.insert(std::filesystem::path(Macro.Storage.Path).filename().string());
+    }
+    return {FileNames.begin(), FileNames.end()};
+}
+
+void StartMacroHotReload() {
+    WatchedDirectory = ApiDefinition->Paths_GetAddonDirectory("MacroManager/macros");
+    if (WatchedDirectory.empty())
+        return;
+
+    std::error_code Error;
+    std::filesystem::create_directories(WatchedDirectory, Error);
+
+    MacroFileWatcher = CreateFileWatcher(WatchedDirectory);
+    if (!MacroFileWatcher) {
+        ApiDefinition->Log(LOGL_WARNING, "MacroManager", "Macro hot reload unavailable: cannot watch macro directory");
+        return;
+    }
+
+    const std::string SequenceDirectory = ApiDefinition->Paths_GetAddonDirectory("MacroManager/sequences");
+    std::filesystem::create_directories(SequenceDirectory, Error);
+    SequenceFileWatcher = CreateFileWatcher(SequenceDirectory);
+}
+
+void StopMacroHotReload() {
+    MacroFileWatcher.reset();
+    SequenceFileWatcher.reset();
+    PendingMacroFiles.clear();
+}
+
+void ApplyMacroFileChanges() {
+    if (!MacroFileWatcher)
+        return;
+
+    const bool SequencesChanged = SequenceFileWatcher && SequenceFileWatcher->HasChanges();
+    if (SequencesChanged)
+        SequenceFileWatcher->TakeChanges();
+    if (!MacroFileWatcher->HasChanges() && !(SequencesChanged && !PendingMacroFiles.empty()))
+        return;
+
+    std::vector<std::string> FileNames = MacroFileWatcher->TakeChanges();
+    for (const auto &FileName : FileNames) {
+        if (FileName.empty()) {
+            FileNames = ListWatchedFiles();
+            break;
+        }
+    }
+    FileNames.insert(FileNames.end(), PendingMacroFiles.begin(), PendingMacroFiles.end());
+    PendingMacroFiles.clear();
+
+    size_t Updated = 0;
+    size_t Removed = 0;
+    for (const auto &FileName : FileNames) {
+        const std::filesystem::path FilePath = std::filesystem::path(WatchedDirectory) / FileName;
+        if (FilePath.extension() != ".json")
+            continue;
+
+        const std::string Path = FilePath.string();
+        std::error_code Error;
+        if (!std::filesystem::exists(FilePath, Error)) {
+            ForgetMacroFile(Path);
+
+            const MacroHandle Handle = Macros.Find(FilePath.stem().string());
+            const Macro *Macro = Macros.Get(Handle);
+            if (!Macro || Macro->Storage.Path != Path)
+                continue;
+
+            const std::string Identifier = Macro->Identifier;
+            UnregisterKeybind(Identifier);
+            Macros.Erase(Handle);
+            JournalDeleteMacro(Identifier);
+            ++Removed;
+            continue;
+        }
+
+        bool AwaitingSequence = false;
+        std::optional<Macro> Reloaded = ReloadMacroFile(Path, AwaitingSequence);
+        if (AwaitingSequence)
+            PendingMacroFiles.insert(FileName);
+        if (!Reloaded)
+            continue;
+
+        if (Reloaded->Identifier.empty())
+            Reloaded->Identifier = FilePath.stem().string();
+
+        if (Macro *Existing = Macros.Get(Macros.Find(Reloaded->Identifier))) {
+            Reloaded->Enabled = Existing->Enabled;
+            ReplaceMacro(*Existing, std::move(*Reloaded));
+            Macros.MarkModified();
+            JournalPutMacro(*Existing);
+        } else {
+            Reloaded->Enabled = false;
+            const Macro *Inserted = Macros.Get(Macros.Insert(std::move(*Reloaded)));
+            RegisterKeybind(*Inserted);
+            JournalPutMacro(*Inserted);
+        }
+        ++Updated;
+    }
+
+    if (Updated == 0 && Removed == 0)
+        return;
+
+    CompileMacroProfiles();
+    ApiDefinition->Log(LOGL_INFO, "MacroManager", ("Hot reloaded " + std::to_string(Updated) + " macro(s), removed " + std::to_string(Removed)).c_str());
+}
\ No newline at end of file
@@ -0,0 +1,7 @@
+#pragma once
+
+void StartMacroHotReload();
+
+void StopMacroHotReload();
+
+void ApplyMacroFileChanges();
\ No newline at end of file
@@ -0,0 +1,226 @@
+#include "macro_journal.h"
+#include "macro_save.h"
+#include "shared.h"
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+constexpr uint64_t JournalCompactionThreshold = 256 * 1024;
+
+static uint64_t JournalBytes = 0;
+static std::thread CompactionThread;
+static std::atomic<bool> CompactionFinished{false};
+static bool CompactionSucceeded = false;
+static std::vector<Macro> CompactionSnapshot;
+
+static std::string JournalPath() { return ApiDefinition->Paths_GetAddonDirectory("MacroManager/journal.ndjson"); }
+
+static std::string CompactingJournalPath() { return ApiDefinition->Paths_GetAddonDirectory("MacroManager/journal.compacting.ndjson"); }
+
+static void FinishCompaction(const bool Wait) {
+    if (!CompactionThread.joinable() || (!Wait && !CompactionFinished))
+        return;
+
+    CompactionThread.join();
+    CompactionFinished = false;
+
+    if (CompactionSucceeded)
+        ApplyMacroSnapshotStorage(CompactionSnapshot);
+    CompactionSnapshot.clear();
+}
+
+static bool RotateJournal() {
+    const std::string Path = JournalPath();
+    const std::string CompactingPath = CompactingJournalPath();
+
+    std::error_code Error;
+    if (!std::filesystem::exists(Path, Error)) {
+        JournalBytes = 0;
+        return true;
+    }
+
+    if (std::filesystem::exists(CompactingPath, Error)) {
+        std::ifstream Source(Path, std::ios::binary);
+        std::ofstream Destination(CompactingPath, std::ios::binary | std::ios::app);
+        if (!Source.is_open() || !Destination.is_open())
+            return false;
+        Destination << Source.rdbuf();
+        Source.close();
+        Destination.close();
+        std::filesystem::remove(Path, Error);
+    } else {
+        std::filesystem::rename(Path, CompactingPath, Error);
+    }
+
+    if (Error)
+        return false;
+
+    JournalBytes = 0;
+    return true;
+}
+
+static void StartCompaction() {
+    FinishCompaction(true);
+
+    if (!RotateJournal()) {
+        ApiDefinition->Log(LOGL_WARNING, "MacroManager", "Failed to rotate macro journal, compaction postponed");
+        return;
+    }
+
+    CompactionSnapshot = TakeMacroSnapshot();
+    CompactionThread = std::thread([CompactingPath = CompactingJournalPath()] {
+        CompactionSucceeded = WriteMacroSnapshot(CompactionSnapshot);
+        if (CompactionSucceeded) {
+            std::error_code Error;
+            std::filesystem::remove(CompactingPath, Error);
+        }
+        CompactionFinished = true;
+    });
+}
+
+static bool AppendJournalRecord(const nlohmann::json &Record) {
+    FinishCompaction(false);
+
+    const std::string Path = JournalPath();
+    try {
+        std::filesystem::create_directories(std::filesystem::path(Path).parent_path());
+
+        const std::string Line = Record.dump() + "\n";
+        std::ofstream File(Path, std::ios::binary | std::ios::app);
+        if (!File.is_open())
+            throw std::runtime_error("Cannot open " + Path);
+        File << Line;
+        File.flush();
+        if (!File)
+            throw std::runtime_error("Cannot write " + Path);
+
+        JournalBytes += Line.size();
+    } catch (const std::exception &e) {
+        ApiDefinition->Log(LOGL_WARNING, "MacroManager", ("Failed to journal macro edit, saving full snapshot: " + std::string(e.what())).c_str());
+        return SaveMacrosToJson();
+    }
+
+    if (JournalBytes >= JournalCompactionThreshold && !CompactionThread.joinable())
+        StartCompaction();
+
+    return true;
+}
+
+static size_t ReplayJournalFile(const std::string &Path) {
+    std::ifstream File(Path, std::ios::binary);
+    if (!File.is_open())
+        return 0;
+
+    size_t Replayed = 0;
+    std::streamoff DamagedOffset = -1;
+    std::string Line;
+    for (std::streamoff LineOffset = File.tellg(); std::getline(File, Line); LineOffset = File.tellg()) {
+        if (Line.empty())
+            continue;
+
+        try {
+            const nlohmann::json Record = nlohmann::json::parse(Line);
+            const std::string Operation = Record.at("op").get<std::string>();
+
+            if (Operation == "put") {
+                Macro NewMacro = JsonToMacro(Record.at("macro"));
+                if (Macro *Existing = Macros.Get(Macros.Find(NewMacro.Identifier))) {
+                    ReplaceMacro(*Existing, std::move(NewMacro));
+                    Macros.MarkModified();
+                } else {
+                    Macros.Insert(std::move(NewMacro));
+                }
+            } else if (Operation == "delete") {
+                Macros.Erase(Macros.Find(Record.at("identifier").get<std::string>()));
+            } else if (Operation == "enabled") {
+                if (Macro *Existing = Macros.Get(Macros.Find(Record.at("identifier").get<std::string>()))) {
+                    Existing->Enabled = Record.at("enabled").get<bool>();
+                    Macros.MarkModified();
+                }
+            }
+
+            ++Replayed;
+        } catch (const std::exception &e) {
+            ApiDefinition->Log(LOGL_WARNING, "MacroManager", ("Stopped replaying " + Path + " at a damaged record: " + std::string(e.what())).c_str());
+            DamagedOffset = LineOffset;
+            break;
+        }
+    }
+
+    if (DamagedOffset >= 0) {
+        File.clear();
+        File.seekg(DamagedOffset);
+        {
+            std::ofstream DamagedFile(Path + ".damaged", std::ios::binary | std::ios::app);
+            DamagedFile << File.rdbuf();
+        }
+        File.close();
+
+        std::error_code Error;
+        std::filesystem::resize_file(Path, static_cast<uintmax_t>(DamagedOffset), Error);
+        if (Error)
+            ApiDefinition->Log(LOGL_WARNING, "MacroManager", ("Failed to truncate damaged journal " + Path + ": " + Error.message()).c_str());
+    }
+
+    return Replayed;
+}
+
+bool JournalPutMacro(const Macro &Macro) {
+    nlohmann::json Record;
+    Record["op"] = "put";
+    Record["macro"] = MacroToJson(Macro);
+    return AppendJournalRecord(Record);
+}
+
+bool JournalDeleteMacro(const std::string &Identifier) {
+    nlohmann::json Record;
+    Record["op"] = "delete";
+    Record["identifier"] = Identifier;
+    return AppendJournalRecord(Record);
+}
+
+bool JournalSetMacroEnabled(const std::string &Identifier, const bool Enabled) {
+    nlohmann::json Record;
+    Record["op"] = "enabled";
+    Record["identifier"] = Identifier;
+    Record["enabled"] = Enabled;
+    return AppendJournalRecord(Record);
+}
+
+bool ReplayMacroJournal() {
+    const std::string Path = JournalPath();
+    const std::string CompactingPath = CompactingJournalPath();
+    if (Path.empty() || CompactingPath.empty())
+        return false;
+
+    const size_t Replayed = ReplayJournalFile(CompactingPath) + ReplayJournalFile(Path);
+
+    std::error_code Error;
+    JournalBytes = std::filesystem::exists(Path, Error) ? std::filesystem::file_size(Path, Error) : 0;
+    if (std::filesystem::exists(CompactingPath, Error))
+        JournalBytes += std::filesystem::file_size(CompactingPath, Error);
+
+    if (Replayed > 0)
+        ApiDefinition->Log(LOGL_DEBUG, "MacroManager", ("Replayed " + std::to_string(Replayed) + " journal record(s)").c_str());
+
+    if (JournalBytes >= JournalCompactionThreshold)
+        StartCompaction();
+
+    return true;
+}
+
+void CompactMacroJournal() {
+    FinishCompaction(true);
+
+    if (!RotateJournal()) {
+        ApiDefinition->Log(LOGL_WARNING, "MacroManager", "Failed to rotate macro journal");
+        return;
+    }
+
+    if (SaveMacrosToJson()) {
+        std::error_code Error;
+        std::filesystem::remove(CompactingJournalPath(), Error);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "macro.h"
+#include <string>
+
+bool JournalPutMacro(const Macro &Macro);
+
+bool JournalDeleteMacro(const std::string &Identifier);
+
+bool JournalSetMacroEnabled(const std::string &Identifier, bool Enabled);
+
+bool ReplayMacroJournal();
+
+void CompactMacroJournal();
\ No newline at end of file
@@ -0,0 +1,110 @@
+#include "macro_library.h"
+#include <cstdlib>
+
+static uint32_t IdentifierNumber(const std::string &Identifier) {
+    if (Identifier.rfind("MACRO_", 0) != 0)
+        return 0;
+    return static_cast<uint32_t>(std::strtoul(Identifier.c_str() + 6, nullptr, 10));
+}
+
+MacroHandle MacroLibrary::Insert(Macro NewMacro) {
+    if (!IsValidMacroIdentifier(NewMacro.Identifier) || IdentifierToHandle.count(NewMacro.Identifier))
+        NewMacro.Identifier = NextIdentifier();
+
+    if (const uint32_t Number = IdentifierNumber(NewMacro.Identifier); Number >= NextIdentifierNumber)
+        NextIdentifierNumber = Number + 1;
+
+    uint32_t SlotIndex;
+    if (!FreeSlots.empty()) {
+        SlotIndex = FreeSlots.back();
+        FreeSlots.pop_back();
+    } else {
+        SlotIndex = static_cast<uint32_t>(Slots.size());
+        Slots.push_back({0, 0});
+    }
+
+    Slots[SlotIndex].DenseIndex = static_cast<uint32_t>(Dense.size());
+    const MacroHandle Handle(SlotIndex, Slots[SlotIndex].Generation);
+
+    IdentifierToHandle[NewMacro.Identifier] = Handle;
+    Dense.push_back(std::move(NewMacro));
+    DenseToSlot.push_back(SlotIndex);
+    ++Revision;
+
+    return Handle;
+}
+
+bool MacroLibrary::Erase(const MacroHandle Handle) {
+    if (!Contains(Handle))
+        return false;
+
+    const uint32_t DenseIndex = Slots[Handle.Index].DenseIndex;
+    const uint32_t LastIndex = static_cast<uint32_t>(Dense.size() - 1);
+
+    IdentifierToHandle.erase(Dense[DenseIndex].Identifier);
+
+    if (DenseIndex != LastIndex) {
+        Dense[DenseIndex] = std::move(Dense[LastIndex]);
+        DenseToSlot[DenseIndex] = DenseToSlot[LastIndex];
+        Slots[DenseToSlot[DenseIndex]].DenseIndex = DenseIndex;
+    }
+
+    Dense.pop_back();
+    DenseToSlot.pop_back();
+
+    ++Slots[Handle.Index].Generation;
+    FreeSlots.push_back(Handle.Index);
+    ++Revision;
+    return true;
+}
+
+void MacroLibrary::Clear() {
+    for (const uint32_t SlotIndex : DenseToSlot) {
+        ++Slots[SlotIndex].Generation;
+        FreeSlots.push_back(SlotIndex);
+    }
+
+    Dense.clear();
+    DenseToSlot.clear();
+    IdentifierToHandle.clear();
+    ++Revision;
+}
+
+Macro *MacroLibrary::Get(const MacroHandle Handle) {
+    if (Handle.Index >= Slots.size() || Slots[Handle.Index].Generation != Handle.Generation)
+        return nullptr;
+    return &Dense[Slots[Handle.Index].DenseIndex];
+}
+
+const Macro *MacroLibrary::Get(const MacroHandle Handle) const {
+    if (Handle.Index >= Slots.size() || Slots[Handle.Index].Generation != Handle.Generation)
+        return nullptr;
+    return &Dense[Slots[Handle.Index].DenseIndex];
+}
+
+MacroHandle MacroLibrary::Find(const std::string &Identifier) const {
+    const auto It = IdentifierToHandle.find(Identifier);
+    return It != IdentifierToHandle.end() ? It->second : InvalidMacroHandle;
+}
+
+MacroHandle MacroLibrary::HandleAt(const size_t DenseIndex) const {
+    if (DenseIndex >= Dense.size())
+        return InvalidMacroHandle;
+    const uint32_t SlotIndex = DenseToSlot[DenseIndex];
+    return {SlotIndex, Slots[SlotIndex].Generation};
+}
+
+std::string MacroLibrary::NextIdentifier() {
+    std::string Identifier;
+    do {
+        Identifier = "MACRO_" + std::to_string(NextIdentifierNumber++);
+    } while (IdentifierToHandle.count(Identifier));
+    return Identifier;
+}
+
+void MacroLibrary::Reserve(const size_t Count) {
+    Dense.reserve(Count);
+    DenseToSlot.reserve(Count);
+    Slots.reserve(Count);
+    IdentifierToHandle.reserve(Count);
+}
\ No newline at end of file
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "macro.h"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct MacroHandle {
+    uint32_t Index;
+    uint32_t Generation;
+
+    constexpr MacroHandle() : Index(UINT32_MAX), Generation(0) {}
+
+    constexpr MacroHandle(const uint32_t index, const uint32_t generation) : Index(index), Generation(generation) {}
+
+    constexpr bool IsValid() const { return Index != UINT32_MAX; }
+
+    constexpr bool operator==(const MacroHandle &Other) const { return Index == Other.Index && Generation == Other.Generation; }
+
+    constexpr bool operator!=(const MacroHandle &Other) const { return !(*this == Other); }
+};
+
+constexpr MacroHandle InvalidMacroHandle{};
+
+class MacroLibrary {
+public:
+    MacroHandle Insert(Macro NewMacro);
+
+    bool Erase(MacroHandle Handle);
+
+    void Clear();
+
+    Macro *Get(MacroHandle Handle);
+
+    const Macro *Get(MacroHandle Handle) const;
+
+    bool Contains(MacroHandle Handle) const { return Get(Handle) != nullptr; }
+
+    MacroHandle Find(const std::string &Identifier) const;
+
+    MacroHandle HandleAt(size_t DenseIndex) const;
+
+    std::string NextIdentifier();
+
+    void Reserve(size_t Count);
+
+    void MarkModified() { ++Revision; }
+
+    uint64_t Version() const { return Revision; }
+
+    size_t size() const { return Dense.size(); }
+
+    bool empty() const { return Dense.empty(); }
+
+    Macro &operator[](const size_t DenseIndex) { return Dense[DenseIndex]; }
+
+    const Macro &operator[](const size_t DenseIndex) const { return Dense[DenseIndex]; }
+
+    std::vector<Macro>::iterator begin() { return Dense.begin(); }
+
+    std::vector<Macro>::iterator end() { return Dense.end(); }
+
+    std::vector<Macro>::const_iterator begin() const { return Dense.begin(); }
+
+    std::vector<Macro>::const_iterator end() const { return Dense.end(); }
+
+private:
+    struct Slot {
+        uint32_t DenseIndex;
+        uint32_t Generation;
+    };
+
+    std::vector<Macro> Dense;
+    std::vector<uint32_t> DenseToSlot;
+    std::vector<Slot> Slots;
+    std::vector<uint32_t> FreeSlots;
+    std::unordered_map<std::string, MacroHandle> IdentifierToHandle;
+    uint32_t NextIdentifierNumber = 1;
+    uint64_t Revision = 0;
+};
\ No newline at end of file
@@ -1,82 +1,146 @@
 #include "macro_manager.h"
 #include "keybind_manager.h"
 #include "macro.h"
-#include "macro_save.h"
+#include "macro_journal.h"
+#include "macro_profile.h"
+#include "macro_sax.h"
+#include "macro_share_code.h"
 #include "nexus/Nexus.h"
-#include "nlohmann/json.hpp"
 #include "shared.h"
 #include <string>
 
-void DeleteMacro(const size_t Index) {
-    if (Index >= Macros.size())
+void DeleteMacro(const MacroHandle Handle) {
+    const Macro *Macro = Macros.Get(Handle);
+    if (!Macro)
         return;
 
-    UnregisterKeybind(Macros[Index].Identifier);
+    const std::string Identifier = Macro->Identifier;
+    UnregisterKeybind(Identifier);
+    Macros.Erase(Handle);
+    JournalDeleteMacro(Identifier);
+    CompileMacroProfiles();
 
-    Macros[Index].Actions.clear();
-    Macros[Index].Enabled = false;
-    Macros[Index].Name = "Empty";
-    Macros[Index].Identifier = "MACRO_" + std::to_string(Index + 1);
-
-    ApiDefinition->Log(LOGL_INFO, "MacroManager", ("Macro slot " + std::to_string(Index + 1) + " cleared").c_str());
+    ApiDefinition->Log(LOGL_INFO, "MacroManager", ("Macro " + Identifier + " deleted").c_str());
 }
 
-void SaveMacro(const std::string &Name, const int Slot, const std::vector<KeybindAction> &Actions) {
+MacroHandle SaveMacro(const std::string &Name, const MacroHandle Handle, const std::vector<KeybindAction> &Actions, const std::string &Profile) {
     if (Name.empty()) {
         ApiDefinition->Log(LOGL_WARNING, "MacroManager", "Cannot save macro: name is empty");
-        return;
+        return InvalidMacroHandle;
     }
 
     if (Actions.empty()) {
         ApiDefinition->Log(LOGL_WARNING, "MacroManager", "Cannot save macro: no actions defined");
-        return;
+        return InvalidMacroHandle;
     }
 
-    if (Slot < 0 || Slot >= 10) {
-        ApiDefinition->Log(LOGL_WARNING, "MacroManager", "Cannot save macro: invalid slot number");
-        return;
+    MacroHandle SavedHandle = Handle;
+    Macro *Macro = Macros.Get(Handle);
+    if (!Macro) {
+        SavedHandle = Macros.Insert(::Macro(Name, Macros.NextIdentifier()));
+        Macro = Macros.Get(SavedHandle);
+    } else {
+        UnregisterKeybind(Macro->Identifier);
     }
 
-    const std::string Identifier = "MACRO_" + std::to_string(Slot + 1);
+    Macro->Name = Name;
+    Macro->Profile = Profile;
+    Macro->Enabled = true;
+    SetMacroActions(*Macro, Actions);
+    Macros.MarkModified();
+    JournalPutMacro(*Macro);
+    CompileMacroProfiles();
 
-    UnregisterKeybind(Macros[Slot].Identifier);
+    RegisterKeybind(*Macro);
 
-    Macros[Slot].Name = Name;
-    Macros[Slot].Identifier = Identifier;
-    Macros[Slot].Actions = Actions;
-    Macros[Slot].Enabled = true;
-
-    RegisterKeybind(Macros[Slot]);
-
-    ApiDefinition->Log(LOGL_INFO, "MacroManager", ("Macro '" + Name + "' saved to slot " + std::to_string(Slot + 1)).c_str());
+    ApiDefinition->Log(LOGL_INFO, "MacroManager", ("Macro '" + Name + "' saved as " + Macro->Identifier).c_str());
 
     ShowEditorWindow = false;
-    SelectedMacroIndex = -1;
+    SelectedMacroHandle = InvalidMacroHandle;
+    return SavedHandle;
 }
 
-void OpenMacroEditor(const int Index) {
-    SelectedMacroIndex = Index;
+void OpenMacroEditor(const MacroHandle Handle) {
+    SelectedMacroHandle = Handle;
     ShowEditorWindow = true;
 
-    if (Index >= 0 && Index < static_cast<int>(Macros.size())) {
-        ApiDefinition->Log(LOGL_DEBUG, "MacroManager", ("Opening editor for macro: " + Macros[Index].Name).c_str());
+    if (const Macro *Macro = Macros.Get(Handle)) {
+        ApiDefinition->Log(LOGL_DEBUG, "MacroManager", ("Opening editor for macro: " + Macro->Name).c_str());
     } else {
         ApiDefinition->Log(LOGL_DEBUG, "MacroManager", "Opening editor for new macro");
     }
 }
 
-bool ImportMacroFromJson(const std::string &JsonString, const int Slot) {
+bool ImportMacroFromJson(const std::string_view JsonString, const MacroHandle Target) {
     try {
-        const nlohmann::json Json = nlohmann::json::parse(JsonString);
-
-        if (const Macro NewMacro = JsonToMacro(Json, Slot); !NewMacro.Actions.empty()) {
-            UnregisterKeybind(Macros[Slot].Identifier);
-            Macros[Slot] = NewMacro;
-            SaveMacrosToJson();
+        Macro NewMacro = IsShareCode(JsonString) ? ShareCodeToMacro(JsonString) : ParseMacroJson(JsonString);
+        if (NewMacro.ActionCount == 0)
+            return true;
+
+        if (Macro *Existing = Macros.Get(Target)) {
+            UnregisterKeybind(Existing->Identifier);
+            NewMacro.Identifier = Existing->Identifier;
+            NewMacro.Profile = Existing->Profile;
+            ReplaceMacro(*Existing, std::move(NewMacro));
+            Macros.MarkModified();
+            RegisterKeybind(*Existing);
+            JournalPutMacro(*Existing);
+        } else {
+            NewMacro.Identifier.clear();
+            const Macro *Inserted = Macros.Get(Macros.Insert(std::move(NewMacro)));
+            RegisterKeybind(*Inserted);
+            JournalPutMacro(*Inserted);
         }
 
+        CompileMacroProfiles();
         return true;
     } catch (...) {
         return false;
     }
+}
+
+size_t ExportMacrosToNdjson(std::ostream &Stream, const std::vector<MacroHandle> &Handles) {
+    size_t Exported = 0;
+    for (const MacroHandle Handle : Handles) {
+        const Macro *Macro = Macros.Get(Handle);
+        if (!Macro)
+            continue;
+
+        Stream << MacroToJson(*Macro).dump() << '\n';
+        if (!Stream)
+            break;
+        ++Exported;
+    }
+    return Exported;
+}
+
+MacroImportSummary ImportMacrosFromNdjson(std::istream &Stream) {
+    MacroImportSummary Summary;
+    std::string Line;
+    while (std::getline(Stream, Line)) {
+        if (!Line.empty() && Line.back() == '\r')
+            Line.pop_back();
+        if (Line.find_first_not_of(" \t") == std::string::npos)
+            continue;
+
+        try {
+            Macro NewMacro = IsShareCode(Line) ? ShareCodeToMacro(Line) : ParseMacroJson(Line);
+            if (NewMacro.ActionCount == 0)
+                continue;
+
+            NewMacro.Identifier.clear();
+            RegisterKeybind(*Macros.Get(Macros.Insert(std::move(NewMacro))));
+            ++Summary.Imported;
+        } catch (...) {
+            ++Summary.Failed;
+        }
+    }
+
+    if (Summary.Imported > 0) {
+        CompactMacroJournal();
+        CompileMacroProfiles();
+    }
+
+    ApiDefinition->Log(LOGL_INFO, "MacroManager", ("Imported " + std::to_string(Summary.Imported) + " macros, " + std::to_string(Summary.Failed) + " invalid line(s) skipped").c_str());
+    return Summary;
 }
\ No newline at end of file
@@ -1,12 +1,26 @@
 #pragma once
 
 #include "macro.h"
+#include "macro_library.h"
+#include <istream>
+#include <ostream>
 #include <string>
+#include <string_view>
+#include <vector>
 
-void DeleteMacro(size_t Index);
+struct MacroImportSummary {
+    size_t Imported = 0;
+    size_t Failed = 0;
+};
 
-void SaveMacro(const std::string &Name, int Slot, const std::vector<KeybindAction> &Actions);
+void DeleteMacro(MacroHandle Handle);
 
-void OpenMacroEditor(int Index = -1);
+MacroHandle SaveMacro(const std::string &Name, MacroHandle Handle, const std::vector<KeybindAction> &Actions, const std::string &Profile);
 
-bool ImportMacroFromJson(const std::string &JsonString, int Slot);
\ No newline at end of file
+void OpenMacroEditor(MacroHandle Handle = InvalidMacroHandle);
+
+bool ImportMacroFromJson(std::string_view JsonString, MacroHandle Target);
+
+size_t ExportMacrosToNdjson(std::ostream &Stream, const std::vector<MacroHandle> &Handles);
+
+MacroImportSummary ImportMacrosFromNdjson(std::istream &Stream);
\ No newline at end of file
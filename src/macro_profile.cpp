@@ -0,0 +1,246 @@
+#include "macro_profile.h"
+#include "game_state.h"
+#include "macro_journal.h"
+#include "mumble/Mumble.h"
+#include "shared.h"
+#include <chrono>
+#include <cwchar>
+#include <filesystem>
+#include <fstream>
+#include <unordered_set>
+
+constexpr size_t IdentityLength = sizeof(Mumble::Data::Identity) / sizeof(wchar_t);
+
+static std::vector<std::shared_ptr<const CompiledMacroProfile>> CompiledProfiles;
+static std::shared_ptr<const CompiledMacroProfile> ActiveProfile;
+static size_t ActiveProfileIndex = SIZE_MAX;
+static wchar_t LastIdentity[IdentityLength] = {};
+static uint32_t LastMapID = UINT32_MAX;
+static uint32_t LastGameStateChanges = UINT32_MAX;
+static std::string CurrentCharacterName;
+static double LastSwitchMicroseconds = 0.0;
+static uint64_t CompiledMacroVersion = UINT64_MAX;
+
+static void AppendUtf8(std::string &Output, const uint32_t CodePoint) {
+    if (CodePoint < 0x80) {
+        Output.push_back(static_cast<char>(CodePoint));
+    } else if (CodePoint < 0x800) {
+        Output.push_back(static_cast<char>(0xC0 | CodePoint >> 6));
+        Output.push_back(static_cast<char>(0x80 | (CodePoint & 0x3F)));
+    } else if (CodePoint < 0x10000) {
+        Output.push_back(static_cast<char>(0xE0 | CodePoint >> 12));
+        Output.push_back(static_cast<char>(0x80 | (CodePoint >> 6 & 0x3F)));
+        Output.push_back(static_cast<char>(0x80 | (CodePoint & 0x3F)));
+    } else {
+        Output.push_back(static_cast<char>(0xF0 | CodePoint >> 18));
+        Output.push_back(static_cast<char>(0x80 | (CodePoint >> 12 & 0x3F)));
+        Output.push_back(static_cast<char>(0x80 | (CodePoint >> 6 & 0x3F)));
+        Output.push_back(static_cast<char>(0x80 | (CodePoint & 0x3F)));
+    }
+}
+
+static std::string ExtractIdentityName(const wchar_t *Identity) {
+    static constexpr wchar_t NameKey[] = L"\"name\":\"";
+    const wchar_t *Cursor = std::wcsstr(Identity, NameKey);
+    if (!Cursor)
+        return "";
+
+    std::string Name;
+    for (Cursor += std::wcslen(NameKey); *Cursor && *Cursor != L'"'; ++Cursor) {
+        uint32_t CodePoint = static_cast<uint32_t>(*Cursor);
+        if (*Cursor == L'\\' && Cursor[1])
+            CodePoint = static_cast<uint32_t>(*++Cursor);
+        if (CodePoint >= 0xD800 && CodePoint < 0xDC00 && Cursor[1] >= 0xDC00 && Cursor[1] < 0xE000)
+            CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (static_cast<uint32_t>(*++Cursor) - 0xDC00);
+        AppendUtf8(Name, CodePoint);
+    }
+    return Name;
+}
+
+static size_t SelectProfileIndex(const std::string &CharacterName, const uint32_t MapID) {
+    size_t BestIndex = 0;
+    int BestScore = 0;
+    for (size_t i = 0; i < MacroProfiles.size(); ++i) {
+        const MacroProfile &Profile = MacroProfiles[i];
+        if (Profile.CharacterName.empty() && Profile.MapID == 0)
+            continue;
+        if (!Profile.CharacterName.empty() && Profile.CharacterName != CharacterName)
+            continue;
+        if (Profile.MapID != 0 && Profile.MapID != MapID)
+            continue;
+
+        const int Score = (Profile.CharacterName.empty() ? 0 : 1) + (Profile.MapID == 0 ? 0 : 2);
+        if (Score > BestScore) {
+            BestScore = Score;
+            BestIndex = i + 1;
+        }
+    }
+    return BestIndex;
+}
+
+static void ActivateProfile(const size_t Index) {
+    if (Index >= CompiledProfiles.size())
+        return;
+    ActiveProfileIndex = Index;
+    std::atomic_store(&ActiveProfile, CompiledProfiles[Index]);
+}
+
+void CompileMacroProfiles() {
+    CompiledMacroVersion = Macros.Version();
+
+    std::vector<std::shared_ptr<const Macro>> Snapshot;
+    Snapshot.reserve(Macros.size());
+    for (const auto &Macro : Macros)
+        Snapshot.push_back(std::make_shared<const ::Macro>(Macro));
+
+    std::unordered_set<std::string> ProfileNames;
+    for (const auto &Profile : MacroProfiles)
+        ProfileNames.insert(Profile.Name);
+
+    auto Default = std::make_shared<CompiledMacroProfile>();
+    Default->Name = "Default";
+    for (const auto &Macro : Snapshot) {
+        if (Macro->Profile.empty() || !ProfileNames.count(Macro->Profile))
+            Default->Bindings.emplace(Macro->Identifier, Macro);
+    }
+
+    std::vector<std::shared_ptr<const CompiledMacroProfile>> Compiled;
+    Compiled.reserve(MacroProfiles.size() + 1);
+    Compiled.push_back(Default);
+
+    for (const auto &Profile : MacroProfiles) {
+        auto Table = std::make_shared<CompiledMacroProfile>(*Default);
+        Table->Name = Profile.Name;
+        for (const auto &Macro : Snapshot) {
+            if (Macro->Profile == Profile.Name)
+                Table->Bindings.emplace(Macro->Identifier, Macro);
+        }
+        Compiled.push_back(std::move(Table));
+    }
+
+    CompiledProfiles = std::move(Compiled);
+    ActivateProfile(SelectProfileIndex(CurrentCharacterName, LastMapID));
+}
+
+void UpdateActiveMacroProfile() {
+    if (Macros.Version() != CompiledMacroVersion)
+        CompileMacroProfiles();
+
+    const auto MumbleLinkData = MumbleLink;
+    const uint32_t Changes = GetGameStateEventCount(EGameStateEvent::MapChanged) + GetGameStateEventCount(EGameStateEvent::CharacterChanged);
+    if (!MumbleLinkData || Changes == LastGameStateChanges)
+        return;
+    LastGameStateChanges = Changes;
+
+    const bool IdentityChanged = std::wmemcmp(LastIdentity, MumbleLinkData->Identity, IdentityLength - 1) != 0;
+    if (!IdentityChanged && MumbleLinkData->Context.MapID == LastMapID)
+        return;
+
+    const auto SwitchStart = std::chrono::steady_clock::now();
+
+    if (IdentityChanged) {
+        std::wmemcpy(LastIdentity, MumbleLinkData->Identity, IdentityLength - 1);
+        CurrentCharacterName = ExtractIdentityName(LastIdentity);
+    }
+    LastMapID = MumbleLinkData->Context.MapID;
+
+    const size_t Index = SelectProfileIndex(CurrentCharacterName, LastMapID);
+    if (Index == ActiveProfileIndex)
+        return;
+
+    ActivateProfile(Index);
+    LastSwitchMicroseconds = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - SwitchStart).count();
+
+    ApiDefinition->Log(LOGL_DEBUG, "MacroManager", ("Switched to macro profile: " + CompiledProfiles[Index]->Name).c_str());
+}
+
+void DeleteMacroProfile(const size_t Index) {
+    if (Index >= MacroProfiles.size())
+        return;
+
+    const std::string Name = MacroProfiles[Index].Name;
+    MacroProfiles.erase(MacroProfiles.begin() + static_cast<std::ptrdiff_t>(Index));
+
+    for (auto &Macro : Macros) {
+        if (Macro.Profile != Name)
+            continue;
+        Macro.Profile.clear();
+        Macros.MarkModified();
+        JournalPutMacro(Macro);
+    }
+
+    SaveMacroProfilesToJson();
+    CompileMacroProfiles();
+}
+
+std::shared_ptr<const Macro> FindActiveMacro(const char *Identifier) {
+    const auto Profile = std::atomic_load(&ActiveProfile);
+    if (!Profile)
+        return nullptr;
+
+    const auto Binding = Profile->Bindings.find(Identifier);
+    return Binding != Profile->Bindings.end() ? Binding->second : nullptr;
+}
+
+std::shared_ptr<const CompiledMacroProfile> GetActiveMacroProfile() { return std::atomic_load(&ActiveProfile); }
+
+double GetLastProfileSwitchMicroseconds() { return LastSwitchMicroseconds; }
+
+const std::string &GetCurrentCharacterName() { return CurrentCharacterName; }
+
+uint32_t GetCurrentMapID() { return LastMapID == UINT32_MAX ? 0 : LastMapID; }
+
+bool SaveMacroProfilesToJson() {
+    const std::string ProfilesPath = ApiDefinition->Paths_GetAddonDirectory("MacroManager/profiles.json");
+    try {
+        if (ProfilesPath.empty())
+            return false;
+
+        nlohmann::json Profiles = nlohmann::json::array();
+        for (const auto &Profile : MacroProfiles) {
+            nlohmann::json Entry;
+            Entry["name"] = Profile.Name;
+            Entry["character"] = Profile.CharacterName;
+            Entry["mapId"] = Profile.MapID;
+            Profiles.push_back(std::move(Entry));
+        }
+
+        nlohmann::json Root;
+        Root["version"] = "1.0.0";
+        Root["profiles"] = std::move(Profiles);
+
+        std::filesystem::create_directories(std::filesystem::path(ProfilesPath).parent_path());
+        std::ofstream File(ProfilesPath, std::ios::binary | std::ios::trunc);
+        if (!File.is_open())
+            return false;
+        File << Root.dump(2);
+        return true;
+    } catch (const std::exception &e) {
+        ApiDefinition->Log(LOGL_WARNING, "MacroManager", ("Failed to save profiles: " + std::string(e.what())).c_str());
+        return false;
+    }
+}
+
+bool LoadMacroProfilesFromJson() {
+    const std::string ProfilesPath = ApiDefinition->Paths_GetAddonDirectory("MacroManager/profiles.json");
+    try {
+        MacroProfiles.clear();
+
+        std::ifstream File(ProfilesPath, std::ios::binary);
+        if (!File.is_open())
+            return false;
+
+        const nlohmann::json Root = nlohmann::json::parse(File);
+        for (const auto &Entry : Root.at("profiles")) {
+            const std::string Name = Entry.at("name").get<std::string>();
+            if (Name.empty())
+                continue;
+            MacroProfiles.emplace_back(Name, Entry.value("character", std::string()), Entry.value("mapId", 0u));
+        }
+        return true;
+    } catch (const std::exception &e) {
+        ApiDefinition->Log(LOGL_WARNING, "MacroManager", ("Failed to load profiles: " + std::string(e.what())).c_str());
+        MacroProfiles.clear();
+        return false;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "macro_library.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct MacroProfile {
+    std::string Name;
+    std::string CharacterName;
+    uint32_t MapID;
+
+    MacroProfile(std::string n, std::string character, const uint32_t map) : Name(std::move(n)), CharacterName(std::move(character)), MapID(map) {}
+};
+
+// Bindings hold immutable copies so the input thread never reads the library, which the render thread mutates.
+struct CompiledMacroProfile {
+    std::string Name;
+    std::unordered_map<std::string, std::shared_ptr<const Macro>> Bindings;
+};
+
+void CompileMacroProfiles();
+
+void UpdateActiveMacroProfile();
+
+void DeleteMacroProfile(size_t Index);
+
+std::shared_ptr<const Macro> FindActiveMacro(const char *Identifier);
+
+std::shared_ptr<const CompiledMacroProfile> GetActiveMacroProfile();
+
+double GetLastProfileSwitchMicroseconds();
+
+const std::string &GetCurrentCharacterName();
+
+uint32_t GetCurrentMapID();
+
+bool SaveMacroProfilesToJson();
+
+bool LoadMacroProfilesFromJson();
\ No newline at end of file
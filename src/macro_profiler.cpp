@@ -0,0 +1,196 @@
+#include "macro_profiler.h"
+
+#ifdef MACRO_PROFILER
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+
+constexpr size_t ProfileScopeCount = static_cast<size_t>(EProfileScope::Count);
+constexpr uint32_t ProfileSubBucketBits = 3;
+constexpr uint32_t ProfileSubBuckets = 1u << ProfileSubBucketBits;
+constexpr size_t ProfileBucketCount = (64 - ProfileSubBucketBits + 1) * ProfileSubBuckets;
+constexpr size_t MaxProfiledThreads = 8;
+constexpr size_t ProfileRingCapacity = 4096;
+constexpr uint32_t ProfileScopeShift = 56;
+constexpr uint64_t ProfileCycleMask = (uint64_t(1) << ProfileScopeShift) - 1;
+constexpr double ProfileDecay = 0.87;
+constexpr double ProfileBucketThreshold = 0.05;
+constexpr auto ProfileUpdateInterval = std::chrono::seconds(1);
+
+// Raw samples, each the scope in the top byte over its cycle count. The owning thread only stores
+// a slot and publishes Head; UpdateProfileStats drains the ring every frame and does the bucketing.
+struct ProfileThreadBlock {
+    std::atomic<uint64_t> Head{0};
+    std::atomic<uint64_t> Samples[ProfileRingCapacity];
+    uint64_t SeenHead = 0;
+};
+
+static std::atomic<ProfileThreadBlock *> ThreadBlocks[MaxProfiledThreads];
+static std::atomic<size_t> ThreadBlockCount{0};
+static thread_local ProfileThreadBlock *CurrentThreadBlock = nullptr;
+static thread_local bool ThreadBlockClaimed = false;
+
+static uint64_t DrainedBuckets[ProfileScopeCount][ProfileBucketCount];
+static uint64_t DrainedCycles[ProfileScopeCount];
+static double RecentBuckets[ProfileScopeCount][ProfileBucketCount];
+static double RecentCycles[ProfileScopeCount];
+static ProfileScopeStats ScopeStats[ProfileScopeCount];
+static bool ProfileClockStarted = false;
+static std::chrono::steady_clock::time_point ProfileClockStart;
+static std::chrono::steady_clock::time_point LastProfileUpdate;
+static uint64_t ProfileClockStartCycles = 0;
+
+static size_t GetProfileBucket(const uint64_t Cycles) {
+    if (Cycles < ProfileSubBuckets)
+        return static_cast<size_t>(Cycles);
+    const uint32_t Exponent = 63 - static_cast<uint32_t>(__builtin_clzll(Cycles));
+    return (Exponent - ProfileSubBucketBits + 1) * ProfileSubBuckets + ((Cycles >> (Exponent - ProfileSubBucketBits)) & (ProfileSubBuckets - 1));
+}
+
+static double GetProfileBucketStart(const size_t Bucket) {
+    if (Bucket < ProfileSubBuckets)
+        return static_cast<double>(Bucket);
+    const int Exponent = static_cast<int>(Bucket / ProfileSubBuckets + ProfileSubBucketBits - 1);
+    return std::ldexp(static_cast<double>(ProfileSubBuckets + Bucket % ProfileSubBuckets), Exponent - static_cast<int>(ProfileSubBucketBits));
+}
+
+static ProfileThreadBlock *ClaimProfileThreadBlock() {
+    ThreadBlockClaimed = true;
+    const size_t Index = ThreadBlockCount.fetch_add(1, std::memory_order_relaxed);
+    if (Index >= MaxProfiledThreads)
+        return nullptr;
+
+    ProfileThreadBlock *Block = new ProfileThreadBlock();
+    ThreadBlocks[Index].store(Block, std::memory_order_release);
+    return Block;
+}
+
+void RecordProfileSample(const EProfileScope Scope, const uint64_t Cycles) {
+    ProfileThreadBlock *Block = CurrentThreadBlock;
+    if (!Block) {
+        if (ThreadBlockClaimed)
+            return;
+        Block = CurrentThreadBlock = ClaimProfileThreadBlock();
+        if (!Block)
+            return;
+    }
+
+    const uint64_t Head = Block->Head.load(std::memory_order_relaxed);
+    Block->Samples[Head & (ProfileRingCapacity - 1)].store(static_cast<uint64_t>(Scope) << ProfileScopeShift | (Cycles & ProfileCycleMask), std::memory_order_relaxed);
+    Block->Head.store(Head + 1, std::memory_order_release);
+}
+
+static void DrainProfileSamples() {
+    const size_t BlockCount = std::min(ThreadBlockCount.load(std::memory_order_relaxed), MaxProfiledThreads);
+    for (size_t i = 0; i < BlockCount; ++i) {
+        ProfileThreadBlock *Block = ThreadBlocks[i].load(std::memory_order_acquire);
+        if (!Block)
+            continue;
+
+        const uint64_t Head = Block->Head.load(std::memory_order_acquire);
+        for (uint64_t Sample = std::max(Block->SeenHead, Head - std::min(Head, ProfileRingCapacity)); Sample < Head; ++Sample) {
+            const uint64_t Packed = Block->Samples[Sample & (ProfileRingCapacity - 1)].load(std::memory_order_relaxed);
+            const size_t ScopeIndex = static_cast<size_t>(Packed >> ProfileScopeShift);
+            const uint64_t Cycles = Packed & ProfileCycleMask;
+            if (ScopeIndex >= ProfileScopeCount)
+                continue;
+            ++DrainedBuckets[ScopeIndex][GetProfileBucket(Cycles)];
+            DrainedCycles[ScopeIndex] += Cycles;
+        }
+        Block->SeenHead = Head;
+    }
+}
+
+static void ComputeProfileScopeStats(const size_t ScopeIndex, const double CyclesPerMicrosecond) {
+    ProfileScopeStats &Stats = ScopeStats[ScopeIndex];
+    const double *Buckets = RecentBuckets[ScopeIndex];
+
+    double Samples = 0.0;
+    size_t First = ProfileBucketCount;
+    size_t Last = 0;
+    for (size_t Bucket = 0; Bucket < ProfileBucketCount; ++Bucket) {
+        Samples += Buckets[Bucket];
+        if (Buckets[Bucket] >= ProfileBucketThreshold) {
+            First = std::min(First, Bucket);
+            Last = Bucket;
+        }
+    }
+
+    if (First == ProfileBucketCount) {
+        Stats.MinMicroseconds = Stats.AverageMicroseconds = Stats.P99Microseconds = Stats.MaxMicroseconds = 0.0;
+        return;
+    }
+
+    double Accumulated = 0.0;
+    size_t P99 = Last;
+    for (size_t Bucket = First; Bucket <= Last; ++Bucket) {
+        Accumulated += Buckets[Bucket];
+        if (Accumulated >= Samples * 0.99) {
+            P99 = Bucket;
+            break;
+        }
+    }
+
+    Stats.MinMicroseconds = GetProfileBucketStart(First) / CyclesPerMicrosecond;
+    Stats.AverageMicroseconds = RecentCycles[ScopeIndex] / Samples / CyclesPerMicrosecond;
+    Stats.P99Microseconds = GetProfileBucketStart(P99 + 1) / CyclesPerMicrosecond;
+    Stats.MaxMicroseconds = GetProfileBucketStart(Last + 1) / CyclesPerMicrosecond;
+}
+
+void UpdateProfileStats() {
+    DrainProfileSamples();
+
+    const auto Now = std::chrono::steady_clock::now();
+    const uint64_t NowCycles = __rdtsc();
+    if (!ProfileClockStarted) {
+        ProfileClockStarted = true;
+        ProfileClockStart = LastProfileUpdate = Now;
+        ProfileClockStartCycles = NowCycles;
+        return;
+    }
+    if (Now - LastProfileUpdate < ProfileUpdateInterval)
+        return;
+    LastProfileUpdate = Now;
+
+    const double CyclesPerMicrosecond = static_cast<double>(NowCycles - ProfileClockStartCycles) / std::chrono::duration<double, std::micro>(Now - ProfileClockStart).count();
+    if (!(CyclesPerMicrosecond > 0.0))
+        return;
+
+    for (size_t ScopeIndex = 0; ScopeIndex < ProfileScopeCount; ++ScopeIndex) {
+        for (size_t Bucket = 0; Bucket < ProfileBucketCount; ++Bucket) {
+            RecentBuckets[ScopeIndex][Bucket] = RecentBuckets[ScopeIndex][Bucket] * ProfileDecay + static_cast<double>(DrainedBuckets[ScopeIndex][Bucket]);
+            ScopeStats[ScopeIndex].Calls += DrainedBuckets[ScopeIndex][Bucket];
+            DrainedBuckets[ScopeIndex][Bucket] = 0;
+        }
+        RecentCycles[ScopeIndex] = RecentCycles[ScopeIndex] * ProfileDecay + static_cast<double>(DrainedCycles[ScopeIndex]);
+        DrainedCycles[ScopeIndex] = 0;
+        ComputeProfileScopeStats(ScopeIndex, CyclesPerMicrosecond);
+    }
+}
+
+const ProfileScopeStats &GetProfileScopeStats(const EProfileScope Scope) {
+    return ScopeStats[static_cast<size_t>(Scope)];
+}
+
+const char *GetProfileScopeName(const EProfileScope Scope) {
+    switch (Scope) {
+    case EProfileScope::AddonRender:
+        return "AddonRender";
+    case EProfileScope::RenderMainWindow:
+        return "RenderMainWindow";
+    case EProfileScope::RenderMacroEditorWindow:
+        return "RenderMacroEditorWindow";
+    case EProfileScope::RenderMacroSaveWindow:
+        return "RenderMacroSaveWindow";
+    case EProfileScope::AddonOptions:
+        return "AddonOptions";
+    case EProfileScope::ProcessKeybind:
+        return "ProcessKeybind";
+    case EProfileScope::ExecuteMacro:
+        return "ExecuteMacro";
+    default:
+        return "Unknown";
+    }
+}
+#endif
\ No newline at end of file
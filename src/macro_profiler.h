@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+enum class EProfileScope {
+    AddonRender,
+    RenderMainWindow,
+    RenderMacroEditorWindow,
+    RenderMacroSaveWindow,
+    AddonOptions,
+    ProcessKeybind,
+    ExecuteMacro,
+    Count
+};
+
+struct ProfileScopeStats {
+    uint64_t Calls = 0;
+    double MinMicroseconds = 0.0;
+    double AverageMicroseconds = 0.0;
+    double P99Microseconds = 0.0;
+    double MaxMicroseconds = 0.0;
+};
+
+#ifdef MACRO_PROFILER
+#include <x86intrin.h>
+
+void RecordProfileSample(EProfileScope Scope, uint64_t Cycles);
+
+void UpdateProfileStats();
+
+const ProfileScopeStats &GetProfileScopeStats(EProfileScope Scope);
+
+const char *GetProfileScopeName(EProfileScope Scope);
+
+class ProfileTimer {
+public:
+    explicit ProfileTimer(const EProfileScope Scope) : Scope(Scope), StartCycles(__rdtsc()) {}
+    ~ProfileTimer() { RecordProfileSample(Scope, __rdtsc() - StartCycles); }
+    ProfileTimer(const ProfileTimer &) = delete;
+    ProfileTimer &operator=(const ProfileTimer &) = delete;
+
+private:
+    EProfileScope Scope;
+    uint64_t StartCycles;
+};
+
+#define MACRO_PROFILE_CONCAT_INNER(a, b) a##b
+#define MACRO_PROFILE_CONCAT(a, b) MACRO_PROFILE_CONCAT_INNER(a, b)
+#define MACRO_PROFILE_SCOPE(Scope) const ProfileTimer MACRO_PROFILE_CONCAT(ScopeTimer, __LINE__)(Scope)
+#else
+#define MACRO_PROFILE_SCOPE(Scope) static_cast<void>(0)
+#endif
\ No newline at end of file
@@ -1,31 +1,300 @@
 #include "macro.h"
+#include "action_sequence_store.h"
+#include "macro_save.h"
+#include "macro_sax.h"
 #include "shared.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
 #include <filesystem>
 #include <fstream>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
 
-bool SaveMacrosToJson() {
-    const std::string AddonConfigurationPath = ApiDefinition->Paths_GetAddonDirectory("MacroManager/macros.json");
+struct MacroFileJob {
+    size_t Position;
+    std::string Path;
+    std::optional<Macro> Loaded;
+    std::string Error;
+    uint64_t FileHash;
+};
+
+static std::unordered_map<std::string, uint64_t> PersistedMacroFiles;
+static std::unordered_set<std::string> PersistedSequenceFiles;
+static uint64_t PersistedManifestHash = 0;
+static std::mutex SnapshotMutex;
+static std::mutex PersistedFilesMutex;
+
+static uint64_t HashBytes(const std::string &Text) {
+    uint64_t Hash = 14695981039346656037ull;
+    for (const unsigned char Character : Text) {
+        Hash ^= Character;
+        Hash *= 1099511628211ull;
+    }
+    return Hash;
+}
+
+static int64_t GetFileWriteTime(const std::string &Path) {
+    return static_cast<int64_t>(std::filesystem::last_write_time(Path).time_since_epoch().count());
+}
+
+static std::string ReadFileToString(const std::string &Path) {
+    std::ifstream File(Path, std::ios::binary);
+    if (!File.is_open())
+        throw std::runtime_error("Cannot open " + Path);
+    return std::string((std::istreambuf_iterator<char>(File)), std::istreambuf_iterator<char>());
+}
+
+static void WriteFileAtomically(const std::string &Path, const std::string &Content) {
+    const std::string TemporaryPath = Path + ".tmp";
+    {
+        std::ofstream File(TemporaryPath, std::ios::binary | std::ios::trunc);
+        if (!File.is_open())
+            throw std::runtime_error("Cannot write " + TemporaryPath);
+        File << Content;
+    }
+    std::filesystem::rename(TemporaryPath, Path);
+}
+
+static std::string SequenceHashText(const uint64_t Hash) {
+    char Buffer[17];
+    std::snprintf(Buffer, sizeof(Buffer), "%016llx", static_cast<unsigned long long>(Hash));
+    return Buffer;
+}
+
+static std::string SequenceFilePath(const std::filesystem::path &SequenceDirectory, const uint64_t Hash) {
+    return (SequenceDirectory / (SequenceHashText(Hash) + ".json")).string();
+}
+
+static std::string MacroFileText(const Macro &Macro, const uint64_t SequenceHash) {
+    nlohmann::json Header;
+    Header["name"] = Macro.Name;
+    Header["identifier"] = Macro.Identifier;
+    if (!Macro.Profile.empty())
+        Header["profile"] = Macro.Profile;
+    Header["enabled"] = Macro.Enabled;
+    Header["actionCount"] = Macro.ActionCount;
+    Header["sequence"] = SequenceHashText(SequenceHash);
+    return Header.dump();
+}
+
+static void ParallelForEach(std::vector<MacroFileJob> &Jobs, void (*Function)(MacroFileJob &)) {
+    const size_t WorkerCount = std::min<size_t>({Jobs.size(), std::max(1u, std::thread::hardware_concurrency()), 4});
+    if (WorkerCount <= 1) {
+        for (auto &Job : Jobs)
+            Function(Job);
+        return;
+    }
+
+    std::atomic<size_t> NextJob{0};
+    std::vector<std::thread> Workers;
+    for (size_t i = 0; i < WorkerCount; ++i) {
+        Workers.emplace_back([&] {
+            for (size_t Index = NextJob++; Index < Jobs.size(); Index = NextJob++)
+                Function(Jobs[Index]);
+        });
+    }
+    for (auto &Worker : Workers)
+        Worker.join();
+}
+
+static Macro ParseMacroFileContent(const std::string &Path, const std::string &Content, const uint64_t ContentHash) {
+    const nlohmann::json Header = nlohmann::json::parse(Content);
+    if (!Header.is_object())
+        throw std::invalid_argument("Invalid macro JSON");
+
+    if (!Header.contains("sequence")) {
+        Macro LoadedMacro = JsonToMacro(Header);
+        LoadedMacro.Storage.Path = Path;
+        LoadedMacro.Storage.BodyPath = Path;
+        LoadedMacro.Storage.FileSize = Content.size();
+        LoadedMacro.Storage.FileTime = GetFileWriteTime(Path);
+        return LoadedMacro;
+    }
+
+    Macro LoadedMacro(Header.at("name").get<std::string>(), Header.value("identifier", std::string()));
+    if (LoadedMacro.Name.empty() || LoadedMacro.Name.length() > 128)
+        throw std::invalid_argument("Invalid macro name");
+    if (!LoadedMacro.Identifier.empty() && !IsValidMacroIdentifier(LoadedMacro.Identifier))
+        throw std::invalid_argument("Invalid macro identifier");
+    LoadedMacro.Profile = Header.value("profile", std::string());
+    LoadedMacro.Enabled = Header.value("enabled", false);
+    LoadedMacro.ActionCount = Header.at("actionCount").get<size_t>();
+    LoadedMacro.Storage.SequenceHash = std::stoull(Header.at("sequence").get<std::string>(), nullptr, 16);
+    LoadedMacro.Storage.Path = Path;
+    LoadedMacro.Storage.BodyPath = SequenceFilePath(std::filesystem::path(Path).parent_path().parent_path() / "sequences", LoadedMacro.Storage.SequenceHash);
+    LoadedMacro.Storage.FileSize = Content.size();
+    LoadedMacro.Storage.FileTime = GetFileWriteTime(Path);
+    LoadedMacro.Storage.ContentHash = ContentHash;
+    LoadedMacro.Actions.reset();
+    return LoadedMacro;
+}
+
+static void ParseMacroFile(MacroFileJob &Job) {
     try {
-        if (AddonConfigurationPath.empty()) {
+        const std::string Content = ReadFileToString(Job.Path);
+        Job.FileHash = HashBytes(Content);
+        Job.Loaded = ParseMacroFileContent(Job.Path, Content, Job.FileHash);
+    } catch (const std::exception &e) {
+        Job.Error = e.what();
+    }
+}
+
+static void ReplaceLibrary(std::vector<Macro> &LoadedMacros) {
+    Macros.Clear();
+    Macros.Reserve(LoadedMacros.size());
+    for (size_t i = 0; i < LoadedMacros.size(); ++i) {
+        if (LoadedMacros[i].Name == "Empty" && LoadedMacros[i].ActionCount == 0)
+            continue;
+
+        if (LoadedMacros[i].Identifier.empty())
+            LoadedMacros[i].Identifier = "MACRO_" + std::to_string(i + 1);
+
+        Macros.Insert(std::move(LoadedMacros[i]));
+    }
+}
+
+static bool MigrateLegacyMacros(const std::string &LegacyPath) {
+    std::ifstream LegacyFile(LegacyPath, std::ios::binary);
+    if (!LegacyFile.is_open())
+        return false;
+
+    std::vector<Macro> LoadedMacros = ParseMacroLibraryJson(LegacyFile);
+    LegacyFile.close();
+    ReplaceLibrary(LoadedMacros);
+
+    if (!SaveMacrosToJson())
+        return false;
+
+    std::error_code Error;
+    std::filesystem::rename(LegacyPath, LegacyPath + ".bak", Error);
+    std::filesystem::remove(std::filesystem::path(LegacyPath).replace_filename("macros.index.json"), Error);
+
+    ApiDefinition->Log(LOGL_INFO, "MacroManager", ("Migrated " + std::to_string(Macros.size()) + " macros to per-macro files").c_str());
+    return true;
+}
+
+bool WriteMacroSnapshot(std::vector<Macro> &Snapshot) {
+    std::lock_guard<std::mutex> Lock(SnapshotMutex);
+    const std::string ManifestPath = ApiDefinition->Paths_GetAddonDirectory("MacroManager/manifest.json");
+    const std::string MacroDirectory = ApiDefinition->Paths_GetAddonDirectory("MacroManager/macros");
+    const std::string SequenceDirectory = ApiDefinition->Paths_GetAddonDirectory("MacroManager/sequences");
+    try {
+        if (ManifestPath.empty() || MacroDirectory.empty() || SequenceDirectory.empty()) {
             if (ApiDefinition)
                 ApiDefinition->Log(LOGL_WARNING, "MacroManager", "No configuration file path available");
             return false;
         }
 
-        std::filesystem::create_directories(std::filesystem::path(AddonConfigurationPath).parent_path());
+        std::filesystem::create_directories(MacroDirectory);
+        std::filesystem::create_directories(SequenceDirectory);
+
+        nlohmann::json Entries = nlohmann::json::array();
+        std::unordered_map<std::string, uint64_t> CurrentFiles;
+        std::unordered_set<std::string> CurrentSequences;
+        size_t FilesWritten = 0;
+        uint64_t BytesWritten = 0;
+
+        for (auto &Macro : Snapshot) {
+            const std::string FileName = Macro.Identifier + ".json";
+            const std::string FilePath = (std::filesystem::path(MacroDirectory) / FileName).string();
+
+            std::shared_ptr<const ActionSequence> Actions;
+            uint64_t SequenceHash = Macro.Storage.SequenceHash;
+            if (IsMacroBodyLoaded(Macro) || SequenceHash == 0) {
+                Actions = GetMacroActions(Macro);
+                SequenceHash = HashActionSequence(*Actions);
+            }
+
+            const std::string SequencePath = SequenceFilePath(SequenceDirectory, SequenceHash);
+            if (CurrentSequences.insert(SequencePath).second && (!PersistedSequenceFiles.count(SequencePath) || !std::filesystem::exists(SequencePath))) {
+                if (!Actions)
+                    Actions = GetMacroActions(Macro);
+                if (HashActionSequence(*Actions) != SequenceHash)
+                    throw std::runtime_error("Action sequence of " + Macro.Identifier + " is missing");
+
+                const std::string SequenceText = ActionsToJson(*Actions).dump();
+                WriteFileAtomically(SequencePath, SequenceText);
+                ++FilesWritten;
+                BytesWritten += SequenceText.size();
+            }
+
+            const std::string Content = MacroFileText(Macro, SequenceHash);
+            const uint64_t ContentHash = HashBytes(Content);
+            if (Macro.Storage.Path != FilePath || ContentHash != Macro.Storage.ContentHash) {
+                {
+                    std::lock_guard<std::mutex> Lock(PersistedFilesMutex);
+                    PersistedMacroFiles[FilePath] = ContentHash;
+                }
+                WriteFileAtomically(FilePath, Content);
+                Macro.Storage.Path = FilePath;
+                Macro.Storage.FileSize = Content.size();
+                Macro.Storage.FileTime = GetFileWriteTime(FilePath);
+                Macro.Storage.ContentHash = ContentHash;
+                ++FilesWritten;
+                BytesWritten += Content.size();
+            }
+            Macro.Storage.BodyPath = SequencePath;
+            Macro.Storage.Offset = 0;
+            Macro.Storage.SequenceHash = SequenceHash;
+
+            nlohmann::json Entry;
+            Entry["name"] = Macro.Name;
+            Entry["identifier"] = Macro.Identifier;
+            if (!Macro.Profile.empty())
+                Entry["profile"] = Macro.Profile;
+            Entry["enabled"] = Macro.Enabled;
+            Entry["actionCount"] = Macro.ActionCount;
+            Entry["file"] = FileName;
+            Entry["sequence"] = SequenceHashText(SequenceHash);
+            Entry["size"] = Macro.Storage.FileSize;
+            Entry["time"] = Macro.Storage.FileTime;
+            Entry["hash"] = Macro.Storage.ContentHash;
+            Entries.push_back(std::move(Entry));
+            CurrentFiles[FilePath] = Macro.Storage.ContentHash;
+        }
+
+        nlohmann::json Manifest;
+        Manifest["version"] = "5.0.0";
+        Manifest["macros"] = std::move(Entries);
+
+        if (const std::string ManifestText = Manifest.dump(2); HashBytes(ManifestText) != PersistedManifestHash) {
+            WriteFileAtomically(ManifestPath, ManifestText);
+            PersistedManifestHash = HashBytes(ManifestText);
+            BytesWritten += ManifestText.size();
+        }
 
-        nlohmann::json Json;
-        Json["version"] = "3.0.0";
+        std::vector<std::string> StaleFiles;
+        {
+            std::lock_guard<std::mutex> Lock(PersistedFilesMutex);
+            for (auto Persisted = PersistedMacroFiles.begin(); Persisted != PersistedMacroFiles.end();) {
+                if (!CurrentFiles.count(Persisted->first)) {
+                    StaleFiles.push_back(Persisted->first);
+                    Persisted = PersistedMacroFiles.erase(Persisted);
+                } else {
+                    ++Persisted;
+                }
+            }
+            for (const auto &[FilePath, ContentHash] : CurrentFiles)
+                PersistedMacroFiles[FilePath] = ContentHash;
+        }
+        for (const auto &StaleFile : StaleFiles) {
+            std::error_code Error;
+            std::filesystem::remove(StaleFile, Error);
+        }
 
-        nlohmann::json MacrosArray = nlohmann::json::array();
-        for (size_t i = 0; i < Macros.size(); ++i) {
-            MacrosArray.push_back(
-                MacroToJson(Macros[i], static_cast<int>(i)));
+        for (const auto &StaleSequence : PersistedSequenceFiles) {
+            if (!CurrentSequences.count(StaleSequence)) {
+                std::error_code Error;
+                std::filesystem::remove(StaleSequence, Error);
+            }
         }
-        Json["macros"] = MacrosArray;
+        PersistedSequenceFiles = std::move(CurrentSequences);
 
-        std::ofstream MacrosJsonSaveFile(AddonConfigurationPath);
-        MacrosJsonSaveFile << Json.dump(2);
+        ApiDefinition->Log(LOGL_DEBUG, "MacroManager", ("Saved " + std::to_string(FilesWritten) + " macro file(s), " + std::to_string(BytesWritten) + " bytes written").c_str());
         return true;
     } catch (const std::exception &e) {
         if (ApiDefinition)
@@ -34,45 +303,203 @@ bool SaveMacrosToJson() {
     }
 }
 
+std::vector<Macro> TakeMacroSnapshot() {
+    std::vector<Macro> Snapshot;
+    Snapshot.reserve(Macros.size());
+    for (const auto &Macro : Macros) {
+        if (!IsMacroBodyLoaded(Macro) && Macro.Storage.SequenceHash == 0)
+            GetMacroActions(Macro);
+        Snapshot.push_back(Macro);
+    }
+    return Snapshot;
+}
+
+void ApplyMacroSnapshotStorage(const std::vector<Macro> &Snapshot) {
+    for (const auto &Saved : Snapshot) {
+        Macro *Live = Macros.Get(Macros.Find(Saved.Identifier));
+        if (Live && (IsMacroBodyLoaded(*Live) || Live->Storage.SequenceHash == Saved.Storage.SequenceHash))
+            SetMacroStorage(*Live, Saved.Storage);
+    }
+}
+
+bool SaveMacrosToJson() {
+    std::vector<Macro> Snapshot = TakeMacroSnapshot();
+    if (!WriteMacroSnapshot(Snapshot))
+        return false;
+    ApplyMacroSnapshotStorage(Snapshot);
+    return true;
+}
+
 bool LoadMacrosFromJson() {
-    std::string AddonConfigurationPath = ApiDefinition->Paths_GetAddonDirectory("MacroManager/macros.json");
+    const std::string ManifestPath = ApiDefinition->Paths_GetAddonDirectory("MacroManager/manifest.json");
+    const std::string MacroDirectory = ApiDefinition->Paths_GetAddonDirectory("MacroManager/macros");
+    const std::string SequenceDirectory = ApiDefinition->Paths_GetAddonDirectory("MacroManager/sequences");
+    const std::string LegacyPath = ApiDefinition->Paths_GetAddonDirectory("MacroManager/macros.json");
     try {
-        if (AddonConfigurationPath.empty()) {
+        if (ManifestPath.empty() || MacroDirectory.empty()) {
             ApiDefinition->Log(LOGL_INFO, "MacroManager", "No config file path available, using defaults");
             return false;
         }
 
-        std::ifstream MacrosJsonSaveFile(AddonConfigurationPath);
-        if (!MacrosJsonSaveFile.is_open()) {
+        if (!std::filesystem::exists(ManifestPath) && std::filesystem::exists(LegacyPath))
+            return MigrateLegacyMacros(LegacyPath);
+
+        if (!std::filesystem::exists(MacroDirectory)) {
             ApiDefinition->Log(LOGL_INFO, "MacroManager", "Config file not found, using defaults");
             return false;
         }
 
-        nlohmann::json Json;
-        MacrosJsonSaveFile >> Json;
+        std::unordered_map<std::string, nlohmann::json> ManifestEntries;
+        std::vector<std::string> ManifestOrder;
+        uint64_t ManifestHash = 0;
+        if (std::filesystem::exists(ManifestPath)) {
+            try {
+                const std::string ManifestText = ReadFileToString(ManifestPath);
+                ManifestHash = HashBytes(ManifestText);
+                const nlohmann::json Manifest = nlohmann::json::parse(ManifestText);
+                for (const auto &Entry : Manifest.at("macros")) {
+                    const std::string FilePath = (std::filesystem::path(MacroDirectory) / Entry.at("file").get<std::string>()).string();
+                    ManifestOrder.push_back(FilePath);
+                    ManifestEntries[FilePath] = Entry;
+                }
+            } catch (const std::exception &e) {
+                ApiDefinition->Log(LOGL_WARNING, "MacroManager", ("Macro manifest unusable, parsing all macro files: " + std::string(e.what())).c_str());
+                ManifestEntries.clear();
+                ManifestOrder.clear();
+                ManifestHash = 0;
+            }
+        }
+
+        std::vector<std::string> MacroFiles;
+        for (const auto &DirectoryEntry : std::filesystem::directory_iterator(MacroDirectory)) {
+            if (DirectoryEntry.is_regular_file() && DirectoryEntry.path().extension() == ".json")
+                MacroFiles.push_back(DirectoryEntry.path().string());
+        }
+        std::sort(MacroFiles.begin(), MacroFiles.end());
+
+        const std::unordered_set<std::string> ExistingFiles(MacroFiles.begin(), MacroFiles.end());
+        std::vector<std::string> OrderedFiles;
+        for (const auto &FilePath : ManifestOrder) {
+            if (ExistingFiles.count(FilePath))
+                OrderedFiles.push_back(FilePath);
+        }
+        for (const auto &FilePath : MacroFiles) {
+            if (!ManifestEntries.count(FilePath))
+                OrderedFiles.push_back(FilePath);
+        }
+
+        std::vector<std::optional<Macro>> LoadedMacros(OrderedFiles.size());
+        std::vector<MacroFileJob> Jobs;
+        for (size_t i = 0; i < OrderedFiles.size(); ++i) {
+            const std::string &FilePath = OrderedFiles[i];
+            const auto Entry = ManifestEntries.find(FilePath);
+
+            try {
+                if (Entry != ManifestEntries.end() && Entry->second.contains("sequence") && Entry->second.at("size").get<uint64_t>() == std::filesystem::file_size(FilePath) && Entry->second.at("time").get<int64_t>() == GetFileWriteTime(FilePath)) {
+                    const nlohmann::json &Header = Entry->second;
+                    Macro NewMacro(Header.at("name").get<std::string>(), Header.at("identifier").get<std::string>());
+                    if (!IsValidMacroIdentifier(NewMacro.Identifier))
+                        throw std::invalid_argument("Invalid macro identifier");
+                    NewMacro.Profile = Header.value("profile", std::string());
+                    NewMacro.Enabled = Header.value("enabled", false);
+                    NewMacro.ActionCount = Header.at("actionCount").get<size_t>();
+                    NewMacro.Storage.SequenceHash = std::stoull(Header.at("sequence").get<std::string>(), nullptr, 16);
+                    NewMacro.Storage.Path = FilePath;
+                    NewMacro.Storage.BodyPath = SequenceFilePath(SequenceDirectory, NewMacro.Storage.SequenceHash);
+                    NewMacro.Storage.FileSize = Header.at("size").get<uint64_t>();
+                    NewMacro.Storage.FileTime = Header.at("time").get<int64_t>();
+                    NewMacro.Storage.ContentHash = Header.at("hash").get<uint64_t>();
+                    NewMacro.Actions.reset();
+                    LoadedMacros[i] = std::move(NewMacro);
+                    continue;
+                }
+            } catch (const std::exception &) {
+            }
+
+            Jobs.push_back({i, FilePath, std::nullopt, {}, 0});
+        }
 
-        if (Json.contains("macros") && Json["macros"].is_array()) {
-            size_t Index = 0;
-            for (const auto &MacroObject : Json["macros"]) {
-                if (Index >= Macros.size())
-                    break;
+        ParallelForEach(Jobs, ParseMacroFile);
 
-                Macros[Index] = JsonToMacro(MacroObject, static_cast<int>(Index));
-                Index++;
+        for (auto &Job : Jobs) {
+            if (!Job.Loaded) {
+                ApiDefinition->Log(LOGL_WARNING, "MacroManager", ("Skipping macro file " + Job.Path + ": " + Job.Error).c_str());
+                continue;
             }
+            LoadedMacros[Job.Position] = std::move(Job.Loaded);
         }
+
+        std::vector<Macro> Library;
+        Library.reserve(LoadedMacros.size());
+        for (auto &LoadedMacro : LoadedMacros) {
+            if (LoadedMacro)
+                Library.push_back(std::move(*LoadedMacro));
+        }
+        ReplaceLibrary(Library);
+
+        std::lock_guard<std::mutex> Lock(SnapshotMutex);
+        std::lock_guard<std::mutex> FilesLock(PersistedFilesMutex);
+        PersistedMacroFiles.clear();
+        for (const auto &FilePath : ExistingFiles)
+            PersistedMacroFiles[FilePath] = 0;
+        for (const auto &Macro : Macros) {
+            if (!Macro.Storage.Path.empty())
+                PersistedMacroFiles[Macro.Storage.Path] = Macro.Storage.ContentHash;
+        }
+        for (const auto &Job : Jobs)
+            PersistedMacroFiles[Job.Path] = Job.FileHash;
+        PersistedSequenceFiles.clear();
+        if (std::filesystem::exists(SequenceDirectory)) {
+            for (const auto &DirectoryEntry : std::filesystem::directory_iterator(SequenceDirectory)) {
+                if (DirectoryEntry.is_regular_file() && DirectoryEntry.path().extension() == ".json")
+                    PersistedSequenceFiles.insert(DirectoryEntry.path().string());
+            }
+        }
+        PersistedManifestHash = ManifestHash;
+
+        ApiDefinition->Log(LOGL_DEBUG, "MacroManager", ("Loaded " + std::to_string(Macros.size()) + " macros, parsed " + std::to_string(Jobs.size()) + " macro file(s)").c_str());
         return true;
     } catch (const std::exception &e) {
         if (ApiDefinition)
             ApiDefinition->Log(LOGL_WARNING, "MacroManager", ("Failed to load macros: " + std::string(e.what())).c_str());
 
-        for (size_t i = 0; i < Macros.size(); ++i) {
-            Macros[i].Name = "Empty";
-            Macros[i].Identifier = "MACRO_" + std::to_string(i + 1);
-            Macros[i].Enabled = false;
-            Macros[i].Actions.clear();
-        }
+        Macros.Clear();
 
         return false;
     }
+}
+
+std::optional<Macro> ReloadMacroFile(const std::string &Path, bool &AwaitingSequence) {
+    AwaitingSequence = false;
+    try {
+        const std::string Content = ReadFileToString(Path);
+        const uint64_t ContentHash = HashBytes(Content);
+        {
+            std::lock_guard<std::mutex> Lock(PersistedFilesMutex);
+            const auto Persisted = PersistedMacroFiles.find(Path);
+            if (Persisted != PersistedMacroFiles.end() && Persisted->second == ContentHash)
+                return std::nullopt;
+        }
+
+        Macro Reloaded = ParseMacroFileContent(Path, Content, ContentHash);
+        if (!IsMacroBodyLoaded(Reloaded)) {
+            if (!std::filesystem::exists(Reloaded.Storage.BodyPath)) {
+                AwaitingSequence = true;
+                return std::nullopt;
+            }
+            GetMacroActions(Reloaded);
+        }
+
+        std::lock_guard<std::mutex> Lock(PersistedFilesMutex);
+        PersistedMacroFiles[Path] = ContentHash;
+        return Reloaded;
+    } catch (const std::exception &e) {
+        ApiDefinition->Log(LOGL_WARNING, "MacroManager", ("Ignoring changed macro file " + Path + ": " + std::string(e.what())).c_str());
+        return std::nullopt;
+    }
+}
+
+void ForgetMacroFile(const std::string &Path) {
+    std::lock_guard<std::mutex> Lock(PersistedFilesMutex);
+    PersistedMacroFiles.erase(Path);
 }
\ No newline at end of file
@@ -1,5 +1,20 @@
 #pragma once
 
+#include "macro.h"
+#include <optional>
+#include <string>
+#include <vector>
+
 bool SaveMacrosToJson();
 
-bool LoadMacrosFromJson();
\ No newline at end of file
+bool LoadMacrosFromJson();
+
+std::vector<Macro> TakeMacroSnapshot();
+
+bool WriteMacroSnapshot(std::vector<Macro> &Snapshot);
+
+void ApplyMacroSnapshotStorage(const std::vector<Macro> &Snapshot);
+
+std::optional<Macro> ReloadMacroFile(const std::string &Path, bool &AwaitingSequence);
+
+void ForgetMacroFile(const std::string &Path);
\ No newline at end of file
@@ -0,0 +1,468 @@
+#include "macro_sax.h"
+#include "macro.h"
+#include "nlohmann/json.hpp"
+#include "string_conversions.h"
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+
+enum class ESaxMode {
+    Macro,
+    Library,
+    Actions
+};
+
+enum class ESaxFrame {
+    Library,
+    MacroList,
+    Macro,
+    ActionList,
+    Action,
+    Skip
+};
+
+enum class ESaxField {
+    None,
+    Macros,
+    Name,
+    Identifier,
+    Profile,
+    Enabled,
+    Actions,
+    InputType,
+    DelayMs,
+    GameBind,
+    IsKeyDown,
+    MouseButton,
+    MoveBeforeClick,
+    MouseX,
+    MouseY,
+    PositionType,
+    Condition,
+    TimeoutMs,
+    Count
+};
+
+enum class ESaxValueType {
+    Absent,
+    Null,
+    Boolean,
+    Integer,
+    Float,
+    String,
+    Structured
+};
+
+struct SaxValue {
+    ESaxValueType Type = ESaxValueType::Absent;
+    bool Boolean = false;
+    int64_t Integer = 0;
+    double Float = 0.0;
+    std::string String;
+
+    bool IsPresent() const { return Type != ESaxValueType::Absent; }
+};
+
+static int SaxValueToInt(const SaxValue &Value, const int Default = 0) {
+    switch (Value.Type) {
+    case ESaxValueType::Absent:
+        return Default;
+    case ESaxValueType::Integer:
+        return static_cast<int>(Value.Integer);
+    case ESaxValueType::Float:
+        return static_cast<int>(Value.Float);
+    default:
+        throw std::invalid_argument("Expected a number in macro JSON");
+    }
+}
+
+static bool SaxValueToBool(const SaxValue &Value, const bool Default = false) {
+    if (Value.Type == ESaxValueType::Absent)
+        return Default;
+    if (Value.Type != ESaxValueType::Boolean)
+        throw std::invalid_argument("Expected a boolean in macro JSON");
+    return Value.Boolean;
+}
+
+static const std::string &SaxValueToString(const SaxValue &Value) {
+    if (Value.Type != ESaxValueType::String)
+        throw std::invalid_argument("Expected a string in macro JSON");
+    return Value.String;
+}
+
+static ESaxField SaxMacroField(const std::string &Key) {
+    if (Key == "name")
+        return ESaxField::Name;
+    if (Key == "identifier")
+        return ESaxField::Identifier;
+    if (Key == "profile")
+        return ESaxField::Profile;
+    if (Key == "enabled")
+        return ESaxField::Enabled;
+    if (Key == "actions")
+        return ESaxField::Actions;
+    return ESaxField::None;
+}
+
+static ESaxField SaxActionField(const std::string &Key) {
+    if (Key == "inputType")
+        return ESaxField::InputType;
+    if (Key == "delayMs")
+        return ESaxField::DelayMs;
+    if (Key == "gameBind")
+        return ESaxField::GameBind;
+    if (Key == "isKeyDown")
+        return ESaxField::IsKeyDown;
+    if (Key == "mouseButton")
+        return ESaxField::MouseButton;
+    if (Key == "moveBeforeClick")
+        return ESaxField::MoveBeforeClick;
+    if (Key == "mouseX")
+        return ESaxField::MouseX;
+    if (Key == "mouseY")
+        return ESaxField::MouseY;
+    if (Key == "positionType")
+        return ESaxField::PositionType;
+    if (Key == "condition")
+        return ESaxField::Condition;
+    if (Key == "timeoutMs")
+        return ESaxField::TimeoutMs;
+    return ESaxField::None;
+}
+
+struct MacroSaxHandler final : nlohmann::json_sax<nlohmann::json> {
+    ESaxMode Mode;
+    std::vector<Macro> Result;
+
+    std::vector<ESaxFrame> Stack;
+    ESaxField PendingField = ESaxField::None;
+
+    std::array<SaxValue, static_cast<size_t>(ESaxField::Count)> Fields;
+    bool ActionsIsArray = false;
+    std::vector<KeybindAction> Actions;
+    std::string PendingActionError;
+
+    explicit MacroSaxHandler(const ESaxMode mode) : Mode(mode) {}
+
+    SaxValue &Field(const ESaxField field) { return Fields[static_cast<size_t>(field)]; }
+
+    void ResetFields(const ESaxField First, const ESaxField Last) {
+        for (auto i = static_cast<size_t>(First); i <= static_cast<size_t>(Last); ++i)
+            Fields[i] = SaxValue();
+    }
+
+    void BeginMacro() {
+        ResetFields(ESaxField::Name, ESaxField::Actions);
+        ActionsIsArray = false;
+        Actions.clear();
+        PendingActionError.clear();
+    }
+
+    void BeginAction() { ResetFields(ESaxField::InputType, ESaxField::TimeoutMs); }
+
+    void FailAction(const char *Message) {
+        if (PendingActionError.empty())
+            PendingActionError = Message;
+    }
+
+    ESaxField TakeField() {
+        const ESaxField field = PendingField;
+        PendingField = ESaxField::None;
+        return field;
+    }
+
+    void FinishAction() {
+        if (!PendingActionError.empty())
+            return;
+
+        try {
+            if (!Field(ESaxField::InputType).IsPresent())
+                throw std::invalid_argument("Invalid action in macro");
+
+            const std::string &InputTypeString = SaxValueToString(Field(ESaxField::InputType));
+            const int DelayMilliseconds = SaxValueToInt(Field(ESaxField::DelayMs));
+
+            if (InputTypeString == "GameBind") {
+                if (!Field(ESaxField::GameBind).IsPresent() || !Field(ESaxField::IsKeyDown).IsPresent())
+                    throw std::invalid_argument("GameBind action missing required fields");
+                const EGameBinds GameBind = StringToIngameKeybind(SaxValueToString(Field(ESaxField::GameBind)));
+                const bool IsKeybindDown = SaxValueToBool(Field(ESaxField::IsKeyDown));
+                Actions.emplace_back(GameBind, IsKeybindDown, DelayMilliseconds);
+            } else if (InputTypeString == "MouseButton") {
+                if (!Field(ESaxField::MouseButton).IsPresent() || !Field(ESaxField::IsKeyDown).IsPresent())
+                    throw std::invalid_argument("MouseButton action missing required fields");
+                const EMouseButton MouseButton = StringToMouseButton(SaxValueToString(Field(ESaxField::MouseButton)));
+                const bool IsKeybindDown = SaxValueToBool(Field(ESaxField::IsKeyDown));
+
+                if (SaxValueToBool(Field(ESaxField::MoveBeforeClick)) && Field(ESaxField::MouseX).IsPresent() && Field(ESaxField::MouseY).IsPresent()) {
+                    const int MouseX = SaxValueToInt(Field(ESaxField::MouseX));
+                    const int MouseY = SaxValueToInt(Field(ESaxField::MouseY));
+                    const SaxValue &PositionTypeValue = Field(ESaxField::PositionType);
+                    const EMousePositionType PositionType = StringToMousePositionType(PositionTypeValue.IsPresent() ? SaxValueToString(PositionTypeValue) : "Absolute");
+                    Actions.emplace_back(MouseButton, IsKeybindDown, EMousePosition(MouseX, MouseY, PositionType), DelayMilliseconds);
+                } else {
+                    Actions.emplace_back(MouseButton, IsKeybindDown, DelayMilliseconds);
+                }
+            } else if (InputTypeString == "MouseMove") {
+                if (!Field(ESaxField::MouseX).IsPresent() || !Field(ESaxField::MouseY).IsPresent())
+                    throw std::invalid_argument("MouseMove action missing coordinates");
+                const int MouseX = SaxValueToInt(Field(ESaxField::MouseX));
+                const int MouseY = SaxValueToInt(Field(ESaxField::MouseY));
+                const SaxValue &PositionTypeValue = Field(ESaxField::PositionType);
+                const EMousePositionType PositionType = StringToMousePositionType(PositionTypeValue.IsPresent() ? SaxValueToString(PositionTypeValue) : "Absolute");
+                Actions.emplace_back(EMousePosition(MouseX, MouseY, PositionType), DelayMilliseconds);
+            } else if (InputTypeString == "WaitCondition") {
+                if (!Field(ESaxField::Condition).IsPresent())
+                    throw std::invalid_argument("WaitCondition action missing condition");
+                const EWaitCondition WaitCondition = StringToWaitCondition(SaxValueToString(Field(ESaxField::Condition)));
+                Actions.emplace_back(WaitCondition, SaxValueToInt(Field(ESaxField::TimeoutMs)), DelayMilliseconds);
+            } else {
+                throw std::invalid_argument("Unknown input type in macro");
+            }
+        } catch (const std::invalid_argument &e) {
+            FailAction(e.what());
+        }
+    }
+
+    void FinishMacro() {
+        if (!Field(ESaxField::Name).IsPresent() || !Field(ESaxField::Actions).IsPresent())
+            throw std::invalid_argument("Invalid macro JSON");
+
+        if (Field(ESaxField::Name).Type != ESaxValueType::String)
+            throw std::invalid_argument("Invalid macro name");
+
+        const std::string &Name = Field(ESaxField::Name).String;
+        if (Name.empty() || Name.length() > 128)
+            throw std::invalid_argument("Invalid macro name");
+
+        if (!ActionsIsArray)
+            throw std::invalid_argument("Actions must be an array");
+
+        const SaxValue &IdentifierValue = Field(ESaxField::Identifier);
+        Macro NewMacro(Name, IdentifierValue.IsPresent() ? SaxValueToString(IdentifierValue) : std::string());
+        if (!NewMacro.Identifier.empty() && !IsValidMacroIdentifier(NewMacro.Identifier))
+            throw std::invalid_argument("Invalid macro identifier");
+        if (Field(ESaxField::Profile).IsPresent())
+            NewMacro.Profile = SaxValueToString(Field(ESaxField::Profile));
+        NewMacro.Enabled = SaxValueToBool(Field(ESaxField::Enabled));
+
+        if (!PendingActionError.empty())
+            throw std::invalid_argument(PendingActionError);
+
+        SetMacroActions(NewMacro, std::move(Actions));
+        Actions.clear();
+        Result.push_back(std::move(NewMacro));
+    }
+
+    bool Scalar(SaxValue Value) {
+        const ESaxField field = TakeField();
+
+        if (Stack.empty()) {
+            if (Mode == ESaxMode::Macro)
+                throw std::invalid_argument("Invalid macro JSON");
+            if (Mode == ESaxMode::Actions)
+                throw std::invalid_argument("Actions must be an array");
+            return true;
+        }
+
+        switch (Stack.back()) {
+        case ESaxFrame::MacroList:
+            throw std::invalid_argument("Invalid macro JSON");
+        case ESaxFrame::ActionList:
+            FailAction("Invalid action in macro");
+            break;
+        case ESaxFrame::Macro:
+        case ESaxFrame::Action:
+            if (field != ESaxField::None) {
+                if (field == ESaxField::Actions)
+                    ActionsIsArray = false;
+                Field(field) = std::move(Value);
+            }
+            break;
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool Structured(const bool IsArray) {
+        const ESaxField field = TakeField();
+
+        if (Stack.empty()) {
+            if (Mode == ESaxMode::Actions) {
+                if (!IsArray)
+                    throw std::invalid_argument("Actions must be an array");
+                Actions.clear();
+                PendingActionError.clear();
+                Stack.push_back(ESaxFrame::ActionList);
+                return true;
+            }
+            if (Mode == ESaxMode::Macro && IsArray)
+                throw std::invalid_argument("Invalid macro JSON");
+            if (Mode == ESaxMode::Macro)
+                BeginMacro();
+            Stack.push_back(IsArray ? ESaxFrame::Skip : (Mode == ESaxMode::Macro ? ESaxFrame::Macro : ESaxFrame::Library));
+            return true;
+        }
+
+        ESaxFrame Next = ESaxFrame::Skip;
+        switch (Stack.back()) {
+        case ESaxFrame::Library:
+            if (field == ESaxField::Macros && IsArray) {
+                Result.clear();
+                Next = ESaxFrame::MacroList;
+            }
+            break;
+        case ESaxFrame::MacroList:
+            if (IsArray)
+                throw std::invalid_argument("Invalid macro JSON");
+            BeginMacro();
+            Next = ESaxFrame::Macro;
+            break;
+        case ESaxFrame::Macro:
+            if (field == ESaxField::Actions) {
+                Field(field).Type = ESaxValueType::Structured;
+                ActionsIsArray = IsArray;
+                if (IsArray) {
+                    Actions.clear();
+                    PendingActionError.clear();
+                    Next = ESaxFrame::ActionList;
+                }
+            } else if (field != ESaxField::None) {
+                Field(field).Type = ESaxValueType::Structured;
+            }
+            break;
+        case ESaxFrame::ActionList:
+            if (IsArray) {
+                FailAction("Invalid action in macro");
+            } else if (PendingActionError.empty()) {
+                BeginAction();
+                Next = ESaxFrame::Action;
+            }
+            break;
+        case ESaxFrame::Action:
+            if (field != ESaxField::None)
+                Field(field).Type = ESaxValueType::Structured;
+            break;
+        case ESaxFrame::Skip:
+            break;
+        }
+
+        Stack.push_back(Next);
+        return true;
+    }
+
+    bool End() {
+        const ESaxFrame Frame = Stack.back();
+        Stack.pop_back();
+
+        if (Frame == ESaxFrame::Action)
+            FinishAction();
+        else if (Frame == ESaxFrame::Macro)
+            FinishMacro();
+        return true;
+    }
+
+    bool null() override {
+        SaxValue Value;
+        Value.Type = ESaxValueType::Null;
+        return Scalar(std::move(Value));
+    }
+
+    bool boolean(const bool val) override {
+        SaxValue Value;
+        Value.Type = ESaxValueType::Boolean;
+        Value.Boolean = val;
+        return Scalar(std::move(Value));
+    }
+
+    bool number_integer(const number_integer_t val) override {
+        SaxValue Value;
+        Value.Type = ESaxValueType::Integer;
+        Value.Integer = val;
+        return Scalar(std::move(Value));
+    }
+
+    bool number_unsigned(const number_unsigned_t val) override {
+        SaxValue Value;
+        Value.Type = ESaxValueType::Integer;
+        Value.Integer = static_cast<int64_t>(val);
+        return Scalar(std::move(Value));
+    }
+
+    bool number_float(const number_float_t val, const string_t &) override {
+        SaxValue Value;
+        Value.Type = ESaxValueType::Float;
+        Value.Float = val;
+        return Scalar(std::move(Value));
+    }
+
+    bool string(string_t &val) override {
+        SaxValue Value;
+        Value.Type = ESaxValueType::String;
+        Value.String = std::move(val);
+        return Scalar(std::move(Value));
+    }
+
+    bool binary(binary_t &) override {
+        SaxValue Value;
+        Value.Type = ESaxValueType::Structured;
+        return Scalar(std::move(Value));
+    }
+
+    bool start_object(std::size_t) override { return Structured(false); }
+
+    bool end_object() override { return End(); }
+
+    bool start_array(std::size_t) override { return Structured(true); }
+
+    bool end_array() override { return End(); }
+
+    bool key(string_t &val) override {
+        switch (Stack.back()) {
+        case ESaxFrame::Library:
+            PendingField = (val == "macros") ? ESaxField::Macros : ESaxField::None;
+            break;
+        case ESaxFrame::Macro:
+            PendingField = SaxMacroField(val);
+            break;
+        case ESaxFrame::Action:
+            PendingField = SaxActionField(val);
+            break;
+        default:
+            PendingField = ESaxField::None;
+            break;
+        }
+        return true;
+    }
+
+    bool parse_error(std::size_t, const std::string &, const nlohmann::detail::exception &ex) override {
+        throw std::invalid_argument(ex.what());
+    }
+};
+
+Macro ParseMacroJson(const std::string_view JsonString) {
+    MacroSaxHandler Handler(ESaxMode::Macro);
+    nlohmann::json::sax_parse(JsonString.data(), JsonString.data() + JsonString.size(), &Handler);
+
+    if (Handler.Result.empty())
+        throw std::invalid_argument("Invalid macro JSON");
+
+    return std::move(Handler.Result.front());
+}
+
+std::vector<Macro> ParseMacroLibraryJson(std::istream &Stream) {
+    MacroSaxHandler Handler(ESaxMode::Library);
+    nlohmann::json::sax_parse(Stream, &Handler, nlohmann::json::input_format_t::json, false);
+    return std::move(Handler.Result);
+}
+
+ActionSequence ParseMacroActionsJson(std::istream &Stream) {
+    MacroSaxHandler Handler(ESaxMode::Actions);
+    nlohmann::json::sax_parse(Stream, &Handler, nlohmann::json::input_format_t::json, false);
+
+    if (!Handler.PendingActionError.empty())
+        throw std::invalid_argument(Handler.PendingActionError);
+
+    return std::move(Handler.Actions);
+}
\ No newline at end of file
@@ -0,0 +1,13 @@
+#pragma once
+
+#include "macro.h"
+#include <istream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+Macro ParseMacroJson(std::string_view JsonString);
+
+std::vector<Macro> ParseMacroLibraryJson(std::istream &Stream);
+
+ActionSequence ParseMacroActionsJson(std::istream &Stream);
\ No newline at end of file
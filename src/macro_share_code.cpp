@@ -0,0 +1,408 @@
+#include "macro_share_code.h"
+#include "string_conversions.h"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <stdexcept>
+
+constexpr char ShareCodePrefix[] = "GW2M1-";
+constexpr size_t ShareCodePrefixLength = sizeof(ShareCodePrefix) - 1;
+constexpr size_t MaxShareCodeRawLength = 16 * 1024 * 1024;
+constexpr size_t MinMatchLength = 3;
+constexpr size_t MaxMatchLength = 0x7F + MinMatchLength;
+constexpr size_t MaxMatchDistance = 65535;
+constexpr size_t MatchTableBits = 12;
+
+constexpr char Base64UrlAlphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+enum EShareCodeFormat : uint8_t {
+    SCF_Raw = 0,
+    SCF_Compressed = 1
+};
+
+enum EShareCodeActionFlags : uint8_t {
+    SCA_TypeMask = 0x03,
+    SCA_KeyDown = 0x04,
+    SCA_MoveBeforeClick = 0x08,
+    SCA_Relative = 0x10
+};
+
+class ByteReader {
+public:
+    ByteReader(const std::string &data, const size_t position = 0) : Data(data), Position(position) {}
+
+    uint8_t Byte() {
+        if (Position >= Data.size())
+            throw std::invalid_argument("Share code is truncated");
+        return static_cast<uint8_t>(Data[Position++]);
+    }
+
+    uint64_t Varint() {
+        uint64_t Value = 0;
+        for (int Shift = 0; Shift < 64; Shift += 7) {
+            const uint8_t Next = Byte();
+            Value |= static_cast<uint64_t>(Next & 0x7F) << Shift;
+            if (!(Next & 0x80))
+                return Value;
+        }
+        throw std::invalid_argument("Share code varint is too long");
+    }
+
+    int32_t ZigZag() {
+        const uint64_t Value = Varint();
+        if (Value > UINT32_MAX)
+            throw std::invalid_argument("Share code value out of range");
+        const auto Encoded = static_cast<uint32_t>(Value);
+        return static_cast<int32_t>((Encoded >> 1) ^ (~(Encoded & 1) + 1));
+    }
+
+    std::string Bytes(const size_t Count) {
+        if (Count > Data.size() - Position)
+            throw std::invalid_argument("Share code is truncated");
+        std::string Result = Data.substr(Position, Count);
+        Position += Count;
+        return Result;
+    }
+
+    bool AtEnd() const { return Position == Data.size(); }
+
+    size_t Offset() const { return Position; }
+
+private:
+    const std::string &Data;
+    size_t Position;
+};
+
+static void WriteVarint(std::string &Output, uint64_t Value) {
+    while (Value >= 0x80) {
+        Output.push_back(static_cast<char>((Value & 0x7F) | 0x80));
+        Value >>= 7;
+    }
+    Output.push_back(static_cast<char>(Value));
+}
+
+static void WriteZigZag(std::string &Output, const int32_t Value) {
+    WriteVarint(Output, (static_cast<uint32_t>(Value) << 1) ^ static_cast<uint32_t>(Value >> 31));
+}
+
+static uint32_t HashBytes32(const std::string &Data) {
+    uint32_t Hash = 2166136261u;
+    for (const unsigned char Character : Data) {
+        Hash ^= Character;
+        Hash *= 16777619u;
+    }
+    return Hash;
+}
+
+static void FlushLiterals(std::string &Output, const std::string &Input, size_t Start, const size_t End) {
+    while (Start < End) {
+        const size_t Count = std::min<size_t>(End - Start, 0x80);
+        Output.push_back(static_cast<char>(Count - 1));
+        Output.append(Input, Start, Count);
+        Start += Count;
+    }
+}
+
+static uint32_t MatchHash(const std::string &Input, const size_t Position) {
+    uint32_t Value;
+    std::memcpy(&Value, Input.data() + Position, sizeof(Value));
+    return ((Value & 0xFFFFFF) * 2654435761u) >> (32 - MatchTableBits);
+}
+
+static std::string CompressBytes(const std::string &Input) {
+    std::string Output;
+    Output.reserve(Input.size() / 2);
+    if (Input.size() < sizeof(uint32_t)) {
+        FlushLiterals(Output, Input, 0, Input.size());
+        return Output;
+    }
+
+    std::array<int64_t, size_t{1} << MatchTableBits> Table;
+    Table.fill(-1);
+
+    const size_t HashLimit = Input.size() - sizeof(uint32_t) + 1;
+    size_t LiteralStart = 0;
+    size_t Position = 0;
+    while (Position < HashLimit) {
+        const uint32_t Hash = MatchHash(Input, Position);
+        const int64_t Candidate = Table[Hash];
+        Table[Hash] = static_cast<int64_t>(Position);
+
+        if (Candidate < 0 || Position - Candidate > MaxMatchDistance || Input.compare(Candidate, MinMatchLength, Input, Position, MinMatchLength) != 0) {
+            ++Position;
+            continue;
+        }
+
+        size_t Length = MinMatchLength;
+        while (Position + Length < Input.size() && Length < MaxMatchLength && Input[Candidate + Length] == Input[Position + Length])
+            ++Length;
+
+        FlushLiterals(Output, Input, LiteralStart, Position);
+        Output.push_back(static_cast<char>(0x80 | (Length - MinMatchLength)));
+        WriteVarint(Output, Position - Candidate);
+
+        for (size_t Next = Position + 1; Next < Position + Length && Next < HashLimit; ++Next)
+            Table[MatchHash(Input, Next)] = static_cast<int64_t>(Next);
+
+        Position += Length;
+        LiteralStart = Position;
+    }
+
+    FlushLiterals(Output, Input, LiteralStart, Input.size());
+    return Output;
+}
+
+static std::string DecompressBytes(const std::string &Input, const size_t Start, const size_t RawLength) {
+    std::string Output;
+    Output.reserve(RawLength);
+
+    ByteReader Reader(Input, Start);
+    while (!Reader.AtEnd()) {
+        const uint8_t Control = Reader.Byte();
+        if (!(Control & 0x80)) {
+            const size_t Count = static_cast<size_t>(Control) + 1;
+            if (Output.size() + Count > RawLength)
+                throw std::invalid_argument("Share code payload overflows");
+            Output += Reader.Bytes(Count);
+            continue;
+        }
+
+        const size_t Length = (Control & 0x7F) + MinMatchLength;
+        const uint64_t Distance = Reader.Varint();
+        if (Distance == 0 || Distance > Output.size() || Output.size() + Length > RawLength)
+            throw std::invalid_argument("Share code payload is corrupt");
+
+        const size_t From = Output.size() - Distance;
+        for (size_t i = 0; i < Length; ++i)
+            Output.push_back(Output[From + i]);
+    }
+
+    return Output;
+}
+
+static std::string Base64UrlEncode(const std::string &Input) {
+    std::string Output;
+    Output.reserve((Input.size() * 4 + 2) / 3);
+
+    size_t i = 0;
+    for (; i + 3 <= Input.size(); i += 3) {
+        const uint32_t Block = static_cast<uint8_t>(Input[i]) << 16 | static_cast<uint8_t>(Input[i + 1]) << 8 | static_cast<uint8_t>(Input[i + 2]);
+        Output.push_back(Base64UrlAlphabet[Block >> 18 & 0x3F]);
+        Output.push_back(Base64UrlAlphabet[Block >> 12 & 0x3F]);
+        Output.push_back(Base64UrlAlphabet[Block >> 6 & 0x3F]);
+        Output.push_back(Base64UrlAlphabet[Block & 0x3F]);
+    }
+
+    if (const size_t Remaining = Input.size() - i; Remaining > 0) {
+        uint32_t Block = static_cast<uint8_t>(Input[i]) << 16;
+        if (Remaining == 2)
+            Block |= static_cast<uint8_t>(Input[i + 1]) << 8;
+        Output.push_back(Base64UrlAlphabet[Block >> 18 & 0x3F]);
+        Output.push_back(Base64UrlAlphabet[Block >> 12 & 0x3F]);
+        if (Remaining == 2)
+            Output.push_back(Base64UrlAlphabet[Block >> 6 & 0x3F]);
+    }
+
+    return Output;
+}
+
+static std::string Base64UrlDecode(const std::string_view Input, const size_t Start, const size_t End) {
+    static const std::array<int8_t, 256> DecodeTable = [] {
+        std::array<int8_t, 256> Table{};
+        Table.fill(-1);
+        for (int i = 0; i < 64; ++i)
+            Table[static_cast<uint8_t>(Base64UrlAlphabet[i])] = static_cast<int8_t>(i);
+        return Table;
+    }();
+
+    if ((End - Start) % 4 == 1)
+        throw std::invalid_argument("Share code has an invalid length");
+
+    std::string Output;
+    Output.reserve((End - Start) * 3 / 4);
+
+    uint32_t Block = 0;
+    int Bits = 0;
+    for (size_t i = Start; i < End; ++i) {
+        const int8_t Value = DecodeTable[static_cast<uint8_t>(Input[i])];
+        if (Value < 0)
+            throw std::invalid_argument("Share code contains an invalid character");
+        Block = Block << 6 | static_cast<uint32_t>(Value);
+        Bits += 6;
+        if (Bits >= 8) {
+            Bits -= 8;
+            Output.push_back(static_cast<char>(Block >> Bits & 0xFF));
+        }
+    }
+
+    return Output;
+}
+
+static std::string EncodeMacroBytes(const Macro &Macro) {
+    const std::shared_ptr<const ActionSequence> Actions = GetMacroActions(Macro);
+
+    std::string Output;
+    Output.reserve(Macro.Name.size() + Actions->size() * 4 + 8);
+
+    WriteVarint(Output, Macro.Name.size());
+    Output += Macro.Name;
+    Output.push_back(static_cast<char>(Macro.Enabled ? 1 : 0));
+    WriteVarint(Output, Actions->size());
+
+    for (const auto &Action : *Actions) {
+        uint8_t Flags = static_cast<uint8_t>(Action.MacroInputType);
+        if (Action.IsKeybindDown)
+            Flags |= SCA_KeyDown;
+        if (Action.MoveBeforeMouseClick)
+            Flags |= SCA_MoveBeforeClick;
+        if (Action.MousePosition.MousePositionType == EMousePositionType::Relative)
+            Flags |= SCA_Relative;
+
+        Output.push_back(static_cast<char>(Flags));
+        WriteZigZag(Output, Action.DelayMilliseconds);
+
+        if (Action.MacroInputType == EMacroInputType::GameBind) {
+            WriteVarint(Output, static_cast<uint32_t>(Action.GameBind));
+        } else if (Action.MacroInputType == EMacroInputType::MouseButton) {
+            Output.push_back(static_cast<char>(Action.MouseButton));
+            if (Action.MoveBeforeMouseClick) {
+                WriteZigZag(Output, Action.MousePosition.x);
+                WriteZigZag(Output, Action.MousePosition.y);
+            }
+        } else if (Action.MacroInputType == EMacroInputType::WaitCondition) {
+            Output.push_back(static_cast<char>(Action.WaitCondition));
+            WriteZigZag(Output, Action.TimeoutMilliseconds);
+        } else {
+            WriteZigZag(Output, Action.MousePosition.x);
+            WriteZigZag(Output, Action.MousePosition.y);
+        }
+    }
+
+    return Output;
+}
+
+static Macro DecodeMacroBytes(const std::string &Bytes) {
+    ByteReader Reader(Bytes);
+
+    const uint64_t NameLength = Reader.Varint();
+    if (NameLength == 0 || NameLength > 128)
+        throw std::invalid_argument("Invalid macro name");
+
+    Macro NewMacro(Reader.Bytes(NameLength), "");
+    NewMacro.Enabled = Reader.Byte() & 1;
+
+    const uint64_t ActionCount = Reader.Varint();
+    if (ActionCount > Bytes.size())
+        throw std::invalid_argument("Share code action count is corrupt");
+
+    ActionSequence Actions;
+    Actions.reserve(ActionCount);
+    for (uint64_t i = 0; i < ActionCount; ++i) {
+        const uint8_t Flags = Reader.Byte();
+        const bool IsKeybindDown = Flags & SCA_KeyDown;
+        const EMousePositionType PositionType = Flags & SCA_Relative ? EMousePositionType::Relative : EMousePositionType::Absolute;
+        const int DelayMilliseconds = Reader.ZigZag();
+
+        switch (static_cast<EMacroInputType>(Flags & SCA_TypeMask)) {
+        case EMacroInputType::GameBind: {
+            const uint64_t Value = Reader.Varint();
+            const auto GameBind = static_cast<EGameBinds>(Value);
+            if (Value > INT32_MAX || !IsKnownKeybind(GameBind))
+                throw std::invalid_argument("Unknown game bind in share code");
+            Actions.emplace_back(GameBind, IsKeybindDown, DelayMilliseconds);
+            break;
+        }
+        case EMacroInputType::MouseButton: {
+            const uint8_t Button = Reader.Byte();
+            if (Button > static_cast<uint8_t>(EMouseButton::X2))
+                throw std::invalid_argument("Unknown mouse button in share code");
+            if (Flags & SCA_MoveBeforeClick) {
+                const int MouseX = Reader.ZigZag();
+                const int MouseY = Reader.ZigZag();
+                Actions.emplace_back(static_cast<EMouseButton>(Button), IsKeybindDown, EMousePosition(MouseX, MouseY, PositionType), DelayMilliseconds);
+            } else {
+                Actions.emplace_back(static_cast<EMouseButton>(Button), IsKeybindDown, DelayMilliseconds);
+            }
+            break;
+        }
+        case EMacroInputType::MouseMove: {
+            const int MouseX = Reader.ZigZag();
+            const int MouseY = Reader.ZigZag();
+            Actions.emplace_back(EMousePosition(MouseX, MouseY, PositionType), DelayMilliseconds);
+            break;
+        }
+        case EMacroInputType::WaitCondition: {
+            const uint8_t Condition = Reader.Byte();
+            if (Condition > static_cast<uint8_t>(EWaitCondition::MapChanged))
+                throw std::invalid_argument("Unknown wait condition in share code");
+            const int TimeoutMilliseconds = Reader.ZigZag();
+            Actions.emplace_back(static_cast<EWaitCondition>(Condition), TimeoutMilliseconds, DelayMilliseconds);
+            break;
+        }
+        default:
+            throw std::invalid_argument("Unknown input type in share code");
+        }
+    }
+
+    if (!Reader.AtEnd())
+        throw std::invalid_argument("Share code has trailing data");
+
+    SetMacroActions(NewMacro, std::move(Actions));
+    return NewMacro;
+}
+
+std::string MacroToShareCode(const Macro &Macro) {
+    const std::string Raw = EncodeMacroBytes(Macro);
+    const std::string Compressed = CompressBytes(Raw);
+    const bool UseCompressed = Compressed.size() < Raw.size();
+
+    std::string Container;
+    Container.reserve(Raw.size() + 16);
+    Container.push_back(static_cast<char>(UseCompressed ? SCF_Compressed : SCF_Raw));
+    WriteVarint(Container, Raw.size());
+
+    const uint32_t Checksum = HashBytes32(Raw);
+    for (int Shift = 0; Shift < 32; Shift += 8)
+        Container.push_back(static_cast<char>(Checksum >> Shift & 0xFF));
+
+    Container += UseCompressed ? Compressed : Raw;
+    return ShareCodePrefix + Base64UrlEncode(Container);
+}
+
+Macro ShareCodeToMacro(const std::string_view ShareCode) {
+    size_t Start = ShareCode.find_first_not_of(" \t\r\n");
+    const size_t End = ShareCode.find_last_not_of(" \t\r\n") + 1;
+    if (Start == std::string_view::npos || ShareCode.compare(Start, ShareCodePrefixLength, ShareCodePrefix) != 0)
+        throw std::invalid_argument("Not a macro share code");
+    Start += ShareCodePrefixLength;
+
+    const std::string Container = Base64UrlDecode(ShareCode, Start, std::max(Start, End));
+    ByteReader Reader(Container);
+
+    const uint8_t Format = Reader.Byte();
+    const uint64_t RawLength = Reader.Varint();
+    if (RawLength > MaxShareCodeRawLength)
+        throw std::invalid_argument("Share code is too large");
+
+    uint32_t Checksum = 0;
+    for (int Shift = 0; Shift < 32; Shift += 8)
+        Checksum |= static_cast<uint32_t>(Reader.Byte()) << Shift;
+
+    std::string Raw;
+    if (Format == SCF_Compressed)
+        Raw = DecompressBytes(Container, Reader.Offset(), RawLength);
+    else if (Format == SCF_Raw)
+        Raw = Container.substr(Reader.Offset());
+    else
+        throw std::invalid_argument("Unknown share code format");
+
+    if (Raw.size() != RawLength || HashBytes32(Raw) != Checksum)
+        throw std::invalid_argument("Share code checksum mismatch");
+
+    return DecodeMacroBytes(Raw);
+}
+
+bool IsShareCode(const std::string_view Text) {
+    const size_t Start = Text.find_first_not_of(" \t\r\n");
+    return Start != std::string_view::npos && Text.compare(Start, ShareCodePrefixLength, ShareCodePrefix) == 0;
+}
\ No newline at end of file
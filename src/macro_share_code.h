@@ -0,0 +1,11 @@
+#pragma once
+
+#include "macro.h"
+#include <string>
+#include <string_view>
+
+std::string MacroToShareCode(const Macro &Macro);
+
+Macro ShareCodeToMacro(std::string_view ShareCode);
+
+bool IsShareCode(std::string_view Text);
\ No newline at end of file
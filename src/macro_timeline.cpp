@@ -0,0 +1,116 @@
+#include "macro_timeline.h"
+#include <algorithm>
+#include <atomic>
+
+constexpr uint32_t TimelineRingCapacity = 1024;
+constexpr size_t TimelineHistoryCapacity = 1024;
+
+static_assert((TimelineRingCapacity & (TimelineRingCapacity - 1)) == 0, "Timeline ring capacity must be a power of two");
+
+// Single producer (the executor, serialized by MacroMutex) and single consumer (the render thread).
+// The producer only touches WriteIndex and its cached copy of ReadIndex, so a push is two relaxed loads and a release store.
+static MacroTimelineEvent RingSlots[TimelineRingCapacity];
+alignas(64) static std::atomic<uint32_t> RingWriteIndex{0};
+alignas(64) static std::atomic<uint32_t> RingReadIndex{0};
+alignas(64) static uint32_t ProducerCachedReadIndex = 0;
+static std::atomic<uint32_t> DroppedEvents{0};
+static std::atomic<uint32_t> RunCounter{0};
+static std::atomic<bool> Recording{false};
+
+static MacroTimelineEvent History[TimelineHistoryCapacity];
+static size_t HistoryNext = 0;
+static size_t HistoryCount = 0;
+static MacroTimelineStats Stats;
+static double LatenessTotalMilliseconds = 0.0;
+
+int64_t GetMacroTimelineMicroseconds(const std::chrono::steady_clock::time_point Time) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(Time.time_since_epoch()).count();
+}
+
+void SetMacroTimelineRecording(const bool ShouldRecord) {
+    if (Recording.load(std::memory_order_relaxed) == ShouldRecord)
+        return;
+
+    if (ShouldRecord) {
+        HistoryNext = 0;
+        HistoryCount = 0;
+    }
+    Recording.store(ShouldRecord, std::memory_order_relaxed);
+}
+
+bool IsMacroTimelineRecording() {
+    return Recording.load(std::memory_order_relaxed);
+}
+
+uint32_t BeginMacroTimelineRun() {
+    return RunCounter.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+void RecordMacroTimelineAction(const uint32_t Run, const uint32_t ActionIndex, const KeybindAction &Action, const std::chrono::steady_clock::time_point Scheduled) {
+    if (!Recording.load(std::memory_order_relaxed))
+        return;
+
+    const uint32_t Write = RingWriteIndex.load(std::memory_order_relaxed);
+    if (Write - ProducerCachedReadIndex == TimelineRingCapacity) {
+        ProducerCachedReadIndex = RingReadIndex.load(std::memory_order_acquire);
+        if (Write - ProducerCachedReadIndex == TimelineRingCapacity) {
+            DroppedEvents.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    }
+
+    MacroTimelineEvent &Event = RingSlots[Write & (TimelineRingCapacity - 1)];
+    Event.ScheduledMicroseconds = GetMacroTimelineMicroseconds(Scheduled);
+    Event.ActualMicroseconds = GetMacroTimelineMicroseconds(std::chrono::steady_clock::now());
+    Event.Run = Run;
+    Event.ActionIndex = ActionIndex;
+    Event.InputType = Action.MacroInputType;
+    Event.GameBind = Action.GameBind;
+    Event.MouseButton = Action.MouseButton;
+    Event.WaitCondition = Action.WaitCondition;
+    Event.IsKeybindDown = Action.IsKeybindDown;
+    RingWriteIndex.store(Write + 1, std::memory_order_release);
+}
+
+static void AppendHistory(const MacroTimelineEvent &Event) {
+    History[HistoryNext] = Event;
+    HistoryNext = (HistoryNext + 1) % TimelineHistoryCapacity;
+    HistoryCount = std::min(HistoryCount + 1, TimelineHistoryCapacity);
+
+    if (Event.Run != Stats.Run) {
+        Stats.Run = Event.Run;
+        Stats.Actions = 0;
+        Stats.MaxLatenessMilliseconds = 0.0;
+        LatenessTotalMilliseconds = 0.0;
+    }
+    if (Event.InputType == EMacroInputType::WaitCondition)
+        return;
+
+    const double Lateness = static_cast<double>(Event.ActualMicroseconds - Event.ScheduledMicroseconds) / 1000.0;
+    ++Stats.Actions;
+    LatenessTotalMilliseconds += Lateness;
+    Stats.LastLatenessMilliseconds = Lateness;
+    Stats.MeanLatenessMilliseconds = LatenessTotalMilliseconds / Stats.Actions;
+    Stats.MaxLatenessMilliseconds = std::max(Stats.MaxLatenessMilliseconds, Lateness);
+}
+
+void DrainMacroTimeline() {
+    uint32_t Read = RingReadIndex.load(std::memory_order_relaxed);
+    const uint32_t Write = RingWriteIndex.load(std::memory_order_acquire);
+    for (; Read != Write; ++Read)
+        AppendHistory(RingSlots[Read & (TimelineRingCapacity - 1)]);
+    RingReadIndex.store(Read, std::memory_order_release);
+    Stats.Dropped = DroppedEvents.load(std::memory_order_relaxed);
+}
+
+size_t GetMacroTimelineEventCount() {
+    return HistoryCount;
+}
+
+const MacroTimelineEvent &GetMacroTimelineEvent(const size_t NewestFirstIndex) {
+    return History[(HistoryNext + TimelineHistoryCapacity - 1 - NewestFirstIndex) % TimelineHistoryCapacity];
+}
+
+const MacroTimelineStats &GetMacroTimelineStats() {
+    return Stats;
+}
\ No newline at end of file
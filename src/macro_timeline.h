@@ -0,0 +1,45 @@
+#pragma once
+
+#include "macro.h"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+struct MacroTimelineEvent {
+    int64_t ScheduledMicroseconds;
+    int64_t ActualMicroseconds;
+    uint32_t Run;
+    uint32_t ActionIndex;
+    EMacroInputType InputType;
+    EGameBinds GameBind;
+    EMouseButton MouseButton;
+    EWaitCondition WaitCondition;
+    bool IsKeybindDown;
+};
+
+struct MacroTimelineStats {
+    uint32_t Run = 0;
+    uint32_t Actions = 0;
+    double LastLatenessMilliseconds = 0.0;
+    double MeanLatenessMilliseconds = 0.0;
+    double MaxLatenessMilliseconds = 0.0;
+    uint32_t Dropped = 0;
+};
+
+int64_t GetMacroTimelineMicroseconds(std::chrono::steady_clock::time_point Time);
+
+void SetMacroTimelineRecording(bool ShouldRecord);
+
+bool IsMacroTimelineRecording();
+
+uint32_t BeginMacroTimelineRun();
+
+void RecordMacroTimelineAction(uint32_t Run, uint32_t ActionIndex, const KeybindAction &Action, std::chrono::steady_clock::time_point Scheduled);
+
+void DrainMacroTimeline();
+
+size_t GetMacroTimelineEventCount();
+
+const MacroTimelineEvent &GetMacroTimelineEvent(size_t NewestFirstIndex);
+
+const MacroTimelineStats &GetMacroTimelineStats();
\ No newline at end of file
@@ -0,0 +1,86 @@
+#include "macro_view_model.h"
+#include "game_state.h"
+#include "shared.h"
+#include "string_conversions.h"
+#include <string>
+
+static MacroViewModel ViewModel;
+static double RenderMicroseconds = 0.0;
+
+static void RebuildMacroRows() {
+    int ActiveMacros = 0;
+    int TotalMacroActions = 0;
+
+    ViewModel.Rows.resize(Macros.size());
+    for (size_t i = 0; i < Macros.size(); ++i) {
+        const Macro &Macro = Macros[i];
+        MacroRowView &Row = ViewModel.Rows[i];
+        const std::string Index = std::to_string(i);
+
+        Row.Handle = Macros.HandleAt(i);
+        Row.Enabled = Macro.Enabled;
+        Row.Name = Macro.Name;
+        Row.ActionsText = std::to_string(Macro.ActionCount) + " actions";
+        Row.EnabledLabel = "##Enabled" + Index;
+        Row.EditLabel = "Edit##" + Index;
+        Row.DeleteLabel = "Delete##" + Index;
+
+        if (Macro.ActionCount > 0 && Macro.Name != "Empty")
+            ++ActiveMacros;
+        TotalMacroActions += static_cast<int>(Macro.ActionCount);
+    }
+
+    ViewModel.MacroCountText = "Macros (" + std::to_string(Macros.size()) + " total)";
+    ViewModel.ActiveMacrosText = "Active Macros: " + std::to_string(ActiveMacros) + " / " + std::to_string(Macros.size());
+    ViewModel.TotalActionsText = "Total Actions: " + std::to_string(TotalMacroActions);
+}
+
+const MacroViewModel &GetMacroViewModel() {
+    if (ViewModel.MacroVersion != Macros.Version()) {
+        RebuildMacroRows();
+        ViewModel.MacroVersion = Macros.Version();
+    }
+
+    const bool IsCompetitive = GetGameState().IsCompetitive;
+    if (IsCompetitive != ViewModel.IsCompetitive || !ViewModel.GameModeText[0]) {
+        ViewModel.IsCompetitive = IsCompetitive;
+        ViewModel.GameModeText = IsCompetitive ? "COMPETITIVE MODE (PvP/WvW) - MACROS DISABLED" : "PvE MODE - MACROS ENABLED";
+    }
+
+    return ViewModel;
+}
+
+void BuildActionRowView(const KeybindAction &Action, ActionRowView &Row) {
+    Row.HighlightDetail = false;
+    Row.Position.clear();
+    Row.Delay = Action.DelayMilliseconds > 0 ? "(" + std::to_string(Action.DelayMilliseconds) + "ms delay)" : std::string();
+
+    const auto Coordinates = [&Action] { return "(" + std::to_string(Action.MousePosition.x) + ", " + std::to_string(Action.MousePosition.y) + ")"; };
+
+    if (Action.MacroInputType == EMacroInputType::MouseMove) {
+        Row.Kind = EActionRowKind::Move;
+        Row.HighlightDetail = true;
+        Row.Detail = "to " + Coordinates() + (Action.MousePosition.MousePositionType == EMousePositionType::Absolute ? " [Abs]" : " [Rel]");
+    } else if (Action.MacroInputType == EMacroInputType::WaitCondition) {
+        Row.Kind = EActionRowKind::Wait;
+        Row.Detail = std::string("until ") + GetWaitConditionName(Action.WaitCondition);
+        if (Action.TimeoutMilliseconds > 0)
+            Row.Detail += " (timeout " + std::to_string(Action.TimeoutMilliseconds) + "ms)";
+    } else {
+        Row.Kind = Action.IsKeybindDown ? EActionRowKind::Press : EActionRowKind::Release;
+        if (Action.MacroInputType == EMacroInputType::GameBind) {
+            Row.Detail = GetKeybindName(Action.GameBind);
+        } else {
+            Row.HighlightDetail = true;
+            Row.Detail = GetMouseButtonName(Action.MouseButton);
+            if (Action.MoveBeforeMouseClick)
+                Row.Position = "@ " + Coordinates();
+        }
+    }
+}
+
+void RecordRenderMicroseconds(const double Microseconds) {
+    RenderMicroseconds = RenderMicroseconds == 0.0 ? Microseconds : RenderMicroseconds + (Microseconds - RenderMicroseconds) / 32.0;
+}
+
+double GetRenderMicroseconds() { return RenderMicroseconds; }
\ No newline at end of file
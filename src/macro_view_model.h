@@ -0,0 +1,50 @@
+#pragma once
+
+#include "macro_library.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct MacroRowView {
+    MacroHandle Handle;
+    bool Enabled;
+    std::string Name;
+    std::string ActionsText;
+    std::string EnabledLabel;
+    std::string EditLabel;
+    std::string DeleteLabel;
+};
+
+struct MacroViewModel {
+    uint64_t MacroVersion = UINT64_MAX;
+    bool IsCompetitive = false;
+    const char *GameModeText = "";
+    std::string MacroCountText;
+    std::string ActiveMacrosText;
+    std::string TotalActionsText;
+    std::vector<MacroRowView> Rows;
+};
+
+enum class EActionRowKind {
+    Press,
+    Release,
+    Move,
+    Wait
+};
+
+struct ActionRowView {
+    uint64_t Version = 0;
+    EActionRowKind Kind = EActionRowKind::Press;
+    bool HighlightDetail = false;
+    std::string Detail;
+    std::string Position;
+    std::string Delay;
+};
+
+const MacroViewModel &GetMacroViewModel();
+
+void BuildActionRowView(const KeybindAction &Action, ActionRowView &Row);
+
+void RecordRenderMicroseconds(double Microseconds);
+
+double GetRenderMicroseconds();
\ No newline at end of file
@@ -1,7 +1,12 @@
 #include "shared.h"
 #include "macro.h"
+#include "macro_library.h"
+#include "macro_profile.h"
 #include <atomic>
 #include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
 
 AddonDefinition_t AddonDefinition = {};
 AddonAPI_t *ApiDefinition = nullptr;
@@ -10,26 +15,22 @@ NexusLinkData_t *NexusLink = nullptr;
 bool ShowMainWindow = false;
 bool ShowEditorWindow = false;
 bool ShowSaveWindow = false;
-int SelectedMacroIndex = -1;
+bool ShowTimelineWindow = false;
+bool ShowProfilerWindow = false;
+MacroHandle SelectedMacroHandle = InvalidMacroHandle;
 std::atomic<bool> KillMacros{false};
 std::mutex MacroMutex;
 
-std::vector<Macro> Macros = {
-    Macro("Empty", "MACRO_1"),
-    Macro("Empty", "MACRO_2"),
-    Macro("Empty", "MACRO_3"),
-    Macro("Empty", "MACRO_4"),
-    Macro("Empty", "MACRO_5"),
-    Macro("Empty", "MACRO_6"),
-    Macro("Empty", "MACRO_7"),
-    Macro("Empty", "MACRO_8"),
-    Macro("Empty", "MACRO_9"),
-    Macro("Empty", "MACRO_10")};
+MacroLibrary Macros;
+std::vector<MacroProfile> MacroProfiles;
 
-char ImportJsonBuffer[8192] = "";
-char ExportJsonBuffer[8192] = "";
-int ExportSlot = 0;
-int ImportSlot = 0;
-int LastExportSlot = -1;
+std::string ImportJsonBuffer;
+std::string ExportJsonBuffer;
+std::string ExportShareCode;
+std::unordered_set<std::string> BulkExportSelection;
+MacroHandle ExportHandle = InvalidMacroHandle;
+MacroHandle ImportHandle = InvalidMacroHandle;
+MacroHandle LastExportHandle = InvalidMacroHandle;
+uint64_t LastExportVersion = 0;
 char StatusMessage[256] = "";
 float StatusMessageTime = 0.0f;
\ No newline at end of file
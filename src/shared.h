@@ -1,10 +1,15 @@
 #pragma once
 
 #include "macro.h"
+#include "macro_library.h"
+#include "macro_profile.h"
 #include "mumble/Mumble.h"
 #include "nexus/Nexus.h"
 #include <atomic>
 #include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
 
 extern AddonAPI_t *ApiDefinition;
 extern AddonDefinition_t AddonDefinition;
@@ -13,14 +18,20 @@ extern NexusLinkData_t *NexusLinkData;
 extern bool ShowMainWindow;
 extern bool ShowEditorWindow;
 extern bool ShowSaveWindow;
-extern int SelectedMacroIndex;
+extern bool ShowTimelineWindow;
+extern bool ShowProfilerWindow;
+extern MacroHandle SelectedMacroHandle;
 extern std::mutex MacroMutex;
 extern std::atomic<bool> KillMacros;
-extern std::vector<Macro> Macros;
-extern char ImportJsonBuffer[8192];
-extern char ExportJsonBuffer[8192];
-extern int ExportSlot;
-extern int ImportSlot;
-extern int LastExportSlot;
+extern MacroLibrary Macros;
+extern std::vector<MacroProfile> MacroProfiles;
+extern std::string ImportJsonBuffer;
+extern std::string ExportJsonBuffer;
+extern std::string ExportShareCode;
+extern std::unordered_set<std::string> BulkExportSelection;
+extern MacroHandle ExportHandle;
+extern MacroHandle ImportHandle;
+extern MacroHandle LastExportHandle;
+extern uint64_t LastExportVersion;
 extern char StatusMessage[256];
 extern float StatusMessageTime;
\ No newline at end of file
@@ -3,19 +3,28 @@
 #include "macro.h"
 #include "nexus/Nexus.h"
 #include <string>
+#include <string_view>
 
 extern const char *GetKeybindName(EGameBinds Keybind);
 
-extern std::string IngameKeybindToString(EGameBinds Keybind);
+extern std::string_view IngameKeybindToString(EGameBinds Keybind);
 
-extern EGameBinds StringToIngameKeybind(const std::string &KeybindString);
+extern EGameBinds StringToIngameKeybind(std::string_view KeybindString);
+
+extern bool IsKnownKeybind(EGameBinds Keybind);
 
 extern const char *GetMouseButtonName(EMouseButton MouseButton);
 
-extern std::string MouseButtonToString(EMouseButton MouseButton);
+extern std::string_view MouseButtonToString(EMouseButton MouseButton);
+
+extern EMouseButton StringToMouseButton(std::string_view MouseButtonString);
+
+extern std::string_view MousePositionTypeToString(EMousePositionType MousePositionType);
+
+extern EMousePositionType StringToMousePositionType(std::string_view MousePositionTypeString);
 
-extern EMouseButton StringToMouseButton(const std::string &MouseButtonString);
+extern const char *GetWaitConditionName(EWaitCondition WaitCondition);
 
-extern std::string MousePositionTypeToString(EMousePositionType MousePositionType);
+extern std::string_view WaitConditionToString(EWaitCondition WaitCondition);
 
-extern EMousePositionType StringToMousePositionType(const std::string &MousePositionTypeString);
\ No newline at end of file
+extern EWaitCondition StringToWaitCondition(std::string_view WaitConditionString);
\ No newline at end of file